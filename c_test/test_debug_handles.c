@@ -1,4 +1,5 @@
 #include <stdarg.h>
+#include <string.h>
 #include "acutest.h" // https://github.com/mity/acutest
 #include "hpy/debug/src/debug_internal.h"
 
@@ -88,6 +89,103 @@ void test_DHQueue_remove(void)
     check_DHQueue(&q, 0);
 }
 
+typedef struct {
+    DHQueueNode node;
+    long payload;
+} SlabItem;
+
+void test_DHSlab_alloc_free(void)
+{
+    DHSlab s;
+    DHSlab_init(&s, sizeof(SlabItem));
+    TEST_CHECK(s.n_used == 0);
+    TEST_CHECK(DHSlab_capacity(&s) == 0);
+
+    SlabItem *a = DHSlab_alloc(&s);
+    SlabItem *b = DHSlab_alloc(&s);
+    TEST_CHECK(a != NULL && b != NULL && a != b);
+    TEST_CHECK(s.n_used == 2);
+    TEST_CHECK(s.n_chunks == 1);
+    TEST_CHECK(DHSlab_capacity(&s) > 2);
+
+    // freed items are reused first, in LIFO order
+    DHSlab_free(&s, a);
+    DHSlab_free(&s, b);
+    TEST_CHECK(s.n_used == 0);
+    TEST_CHECK(DHSlab_alloc(&s) == b);
+    TEST_CHECK(DHSlab_alloc(&s) == a);
+    TEST_CHECK(s.n_used == 2);
+    DHSlab_clear(&s);
+    TEST_CHECK(s.n_used == 0);
+    TEST_CHECK(s.n_chunks == 0);
+}
+
+void test_DHSlab_many_chunks(void)
+{
+    DHSlab s;
+    SlabItem *items[1000];
+    DHSlab_init(&s, sizeof(SlabItem));
+    for (int i = 0; i < 1000; i++) {
+        items[i] = DHSlab_alloc(&s);
+        items[i]->payload = i;
+    }
+    TEST_CHECK(s.n_used == 1000);
+    TEST_CHECK(s.n_chunks > 1);
+    TEST_CHECK(DHSlab_capacity(&s) >= 1000);
+    for (int i = 0; i < 1000; i++) {
+        TEST_CHECK(items[i]->payload == i);
+    }
+    HPy_ssize_t n_chunks = s.n_chunks;
+    for (int i = 0; i < 1000; i++) {
+        DHSlab_free(&s, items[i]);
+    }
+    // reallocating the same number of items does not need new chunks
+    for (int i = 0; i < 1000; i++) {
+        items[i] = DHSlab_alloc(&s);
+    }
+    TEST_CHECK(s.n_chunks == n_chunks);
+    DHSlab_clear(&s);
+}
+
+void test_DHRawPool(void)
+{
+    DHRawPool p;
+    DHRawPool_init(&p);
+    char *a = DHRawPool_copy(&p, "hello", 6);
+    char *b = DHRawPool_copy(&p, "x", 2);
+    TEST_CHECK(a != NULL && b != NULL && a != b);
+    TEST_CHECK(strcmp(a, "hello") == 0);
+    TEST_CHECK(DHRawPool_used(&p) == 2);
+    TEST_CHECK(DHRawPool_check(a, 6));
+
+    // writes to the data and just after it are detected
+    a[0] = 'H';
+    TEST_CHECK(!DHRawPool_check(a, 6));
+    a[0] = 'h';
+    TEST_CHECK(DHRawPool_check(a, 6));
+    a[6] = 0;
+    TEST_CHECK(!DHRawPool_check(a, 6));
+
+    // the poison is checked as well
+    DHRawPool_protect(b, 2);
+    TEST_CHECK(strcmp(b, "x") != 0);
+    TEST_CHECK(DHRawPool_check(b, 2));
+    b[1] = 0;
+    TEST_CHECK(!DHRawPool_check(b, 2));
+
+    DHRawPool_free(&p, a, 6);
+    DHRawPool_free(&p, b, 2);
+    TEST_CHECK(DHRawPool_used(&p) == 0);
+
+    char big[DHRAWPOOL_MAX_SIZE];
+    memset(big, 'z', sizeof(big));
+    char *c = DHRawPool_copy(&p, big, sizeof(big));
+    TEST_CHECK(c != NULL && memcmp(c, big, sizeof(big)) == 0);
+    TEST_CHECK(DHRawPool_check(c, sizeof(big)));
+    DHRawPool_clear(&p);
+    TEST_CHECK(DHRawPool_used(&p) == 0);
+}
+
 #define MYTEST(X) { #X, X }
 
 TEST_LIST = {
@@ -95,5 +193,8 @@ TEST_LIST = {
     MYTEST(test_DHQueue_append),
     MYTEST(test_DHQueue_popfront),
     MYTEST(test_DHQueue_remove),
+    MYTEST(test_DHSlab_alloc_free),
+    MYTEST(test_DHSlab_many_chunks),
+    MYTEST(test_DHRawPool),
     { NULL, NULL }
 };
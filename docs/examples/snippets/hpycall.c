@@ -132,6 +132,33 @@ Pack_call_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs,
 }
 // END pack_args
 
+// BEGIN kwargs_view
+HPyDef_SLOT(Lazy_call, HPy_tp_call)
+static HPy
+Lazy_call_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs,
+               HPy kwnames)
+{
+    HPyKwargsView kw;
+    HPy verbose, kwd, result = HPy_NULL;
+    int r = 0;
+    if (!HPyKwargsView_Init(ctx, &kw, args, nargs, kwnames))
+        return HPy_NULL;
+    // fast path: the only keyword argument is 'verbose'
+    if (HPyKwargsView_Size(&kw) == 1)
+        r = HPyKwargsView_Get_s(ctx, &kw, "verbose", &verbose);
+    if (r == 1) {
+        // 'verbose' is borrowed from 'args'
+        result = HPy_Dup(ctx, verbose);
+    }
+    else if (r == 0 && HPyKwargsView_AsDict(ctx, &kw, &kwd)) {
+        // slow path: the dict is only created here
+        result = Pack_call_legacy(ctx, self, HPy_NULL, kwd);
+    }
+    HPyKwargsView_Close(ctx, &kw);
+    return result;
+}
+// END kwargs_view
+
 static HPyDef *Point_defines[] = {
     &call,
     &new,
@@ -165,6 +192,15 @@ static HPyType_Spec Pack_spec = {
     .defines = Pack_defines
 };
 
+static HPyDef *Lazy_defines[] = {
+    &Lazy_call,
+    NULL
+};
+static HPyType_Spec Lazy_spec = {
+    .name = "hpycall.Lazy",
+    .defines = Lazy_defines
+};
+
 HPyDef_SLOT(init, HPy_mod_exec)
 static int init_impl(HPyContext *ctx, HPy m)
 {
@@ -177,6 +213,9 @@ static int init_impl(HPyContext *ctx, HPy m)
     if (!HPyHelpers_AddType(ctx, m, "Pack", &Pack_spec, NULL)) {
         return -1;
     }
+    if (!HPyHelpers_AddType(ctx, m, "Lazy", &Lazy_spec, NULL)) {
+        return -1;
+    }
     return 0;
 }
 
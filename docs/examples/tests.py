@@ -122,3 +122,6 @@ def test_call_dot_product():
     assert foo() == 'hello manually initialized call function'
     pack = hpycall.Pack()
     assert pack() is None
+    lazy = hpycall.Lazy()
+    assert lazy(verbose=42) == 42
+    assert lazy(verbose=42, x=1) is None
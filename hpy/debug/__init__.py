@@ -9,3 +9,14 @@ def set_handle_stack_trace_limit(limit):
 def disable_handle_stack_traces():
     from hpy.universal import _debug
     _debug.set_handle_stack_trace_limit(None)
+
+
+def enable_raw_data_pool(max_size=256, sample_period=0):
+    from hpy.universal import _debug
+    _debug.set_raw_data_pool_max_size(max_size)
+    _debug.set_raw_data_sample_period(sample_period)
+
+
+def disable_raw_data_pool():
+    from hpy.universal import _debug
+    _debug.set_raw_data_pool_max_size(0)
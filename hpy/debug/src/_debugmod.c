@@ -128,6 +128,29 @@ static UHPy set_closed_handles_queue_max_size_impl(HPyContext *uctx, UHPy u_self
     return HPy_Dup(uctx, uctx->h_None);
 }
 
+HPyDef_METH(get_slab_stats, "get_slab_stats", HPyFunc_NOARGS,
+            .doc="Return the occupancy of the slabs which store the debug handles, the debug builder handles and the pooled raw data")
+static UHPy get_slab_stats_impl(HPyContext *uctx, UHPy u_self)
+{
+    HPyContext *dctx = hpy_debug_get_ctx(uctx);
+    if (dctx == NULL)
+        return HPy_NULL;
+    HPyDebugInfo *info = get_info(dctx);
+    DHSlab *hs = &info->handle_slab;
+    DHSlab *bs = &info->builder_slab;
+    return HPy_BuildValue(uctx, "{s:{s:n,s:n,s:n},s:{s:n,s:n,s:n},s:{s:n}}",
+            "handles",
+                "used", hs->n_used,
+                "capacity", DHSlab_capacity(hs),
+                "chunks", hs->n_chunks,
+            "builders",
+                "used", bs->n_used,
+                "capacity", DHSlab_capacity(bs),
+                "chunks", bs->n_chunks,
+            "raw_data_pool",
+                "used", DHRawPool_used(&info->raw_data_pool));
+}
+
 HPyDef_METH(get_protected_raw_data_max_size, "get_protected_raw_data_max_size", HPyFunc_NOARGS,
             .doc="Return the maximum size of the retained raw memory associated with closed handles")
 static UHPy get_protected_raw_data_max_size_impl(HPyContext *uctx, UHPy u_self)
@@ -154,6 +177,74 @@ static UHPy set_protected_raw_data_max_size_impl(HPyContext *uctx, UHPy u_self,
     return HPy_Dup(uctx, uctx->h_None);
 }
 
+HPyDef_METH(get_raw_data_pool_max_size, "get_raw_data_pool_max_size", HPyFunc_NOARGS,
+            .doc="Return the maximum size of the raw data which is copied to the pool instead of being page protected")
+static UHPy get_raw_data_pool_max_size_impl(HPyContext *uctx, UHPy u_self)
+{
+    HPyContext *dctx = hpy_debug_get_ctx(uctx);
+    if (dctx == NULL)
+        return HPy_NULL;
+    HPyDebugInfo *info = get_info(dctx);
+    return HPyLong_FromSsize_t(uctx, info->raw_data_pool_max_size);
+}
+
+HPyDef_METH(set_raw_data_pool_max_size, "set_raw_data_pool_max_size", HPyFunc_O,
+            .doc="Set the maximum size of the raw data which is copied to the pool instead of being page protected (0 disables the pool)")
+static UHPy set_raw_data_pool_max_size_impl(HPyContext *uctx, UHPy u_self, UHPy u_size)
+{
+    HPyContext *dctx = hpy_debug_get_ctx(uctx);
+    if (dctx == NULL)
+        return HPy_NULL;
+    HPyDebugInfo *info = get_info(dctx);
+    HPy_ssize_t size = HPyLong_AsSsize_t(uctx, u_size);
+    if (HPyErr_Occurred(uctx))
+        return HPy_NULL;
+    if (size < 0) {
+        HPyErr_SetString(uctx, uctx->h_ValueError,
+                         "the raw data pool max size must not be negative");
+        return HPy_NULL;
+    }
+    if (size > DHRAWPOOL_MAX_SIZE) {
+        HPyErr_SetString(uctx, uctx->h_ValueError,
+                         "the raw data pool max size is too large");
+        return HPy_NULL;
+    }
+    info->raw_data_pool_max_size = size;
+    return HPy_Dup(uctx, uctx->h_None);
+}
+
+HPyDef_METH(get_raw_data_sample_period, "get_raw_data_sample_period", HPyFunc_NOARGS,
+            .doc="Return the period of the raw data copies which are page protected even if they fit in the pool")
+static UHPy get_raw_data_sample_period_impl(HPyContext *uctx, UHPy u_self)
+{
+    HPyContext *dctx = hpy_debug_get_ctx(uctx);
+    if (dctx == NULL)
+        return HPy_NULL;
+    HPyDebugInfo *info = get_info(dctx);
+    return HPyLong_FromSsize_t(uctx, info->raw_data_sample_period);
+}
+
+HPyDef_METH(set_raw_data_sample_period, "set_raw_data_sample_period", HPyFunc_O,
+            .doc="Page protect every Nth raw data copy even if it fits in the pool (0 never does)")
+static UHPy set_raw_data_sample_period_impl(HPyContext *uctx, UHPy u_self, UHPy u_period)
+{
+    HPyContext *dctx = hpy_debug_get_ctx(uctx);
+    if (dctx == NULL)
+        return HPy_NULL;
+    HPyDebugInfo *info = get_info(dctx);
+    HPy_ssize_t period = HPyLong_AsSsize_t(uctx, u_period);
+    if (HPyErr_Occurred(uctx))
+        return HPy_NULL;
+    if (period < 0) {
+        HPyErr_SetString(uctx, uctx->h_ValueError,
+                         "the raw data sample period must not be negative");
+        return HPy_NULL;
+    }
+    info->raw_data_sample_period = period;
+    info->raw_data_sample_counter = 0;
+    return HPy_Dup(uctx, uctx->h_None);
+}
+
 HPyDef_METH(set_on_invalid_handle, "set_on_invalid_handle", HPyFunc_O,
             .doc="Set the function to call when we detect the usage of an invalid handle")
 static UHPy set_on_invalid_handle_impl(HPyContext *uctx, UHPy u_self, UHPy u_arg)
@@ -414,8 +505,13 @@ static HPyDef *module_defines[] = {
     &get_closed_handles,
     &get_closed_handles_queue_max_size,
     &set_closed_handles_queue_max_size,
+    &get_slab_stats,
     &get_protected_raw_data_max_size,
     &set_protected_raw_data_max_size,
+    &get_raw_data_pool_max_size,
+    &set_raw_data_pool_max_size,
+    &get_raw_data_sample_period,
+    &set_raw_data_sample_period,
     &set_on_invalid_handle,
     &set_on_invalid_builder_handle,
     &set_handle_stack_trace_limit,
@@ -12,6 +12,8 @@
 
 DHPy debug_ctx_Dup(HPyContext *dctx, DHPy h);
 void debug_ctx_Close(HPyContext *dctx, DHPy h);
+void debug_ctx_CloseMany(HPyContext *dctx, const DHPy *hs, HPy_ssize_t n);
+void debug_ctx_DupMany(HPyContext *dctx, const DHPy *hs, DHPy *out, HPy_ssize_t n);
 DHPy debug_ctx_Long_FromInt32_t(HPyContext *dctx, int32_t value);
 DHPy debug_ctx_Long_FromUInt32_t(HPyContext *dctx, uint32_t value);
 DHPy debug_ctx_Long_FromInt64_t(HPyContext *dctx, int64_t v);
@@ -71,9 +73,11 @@ int debug_ctx_Callable_Check(HPyContext *dctx, DHPy h);
 DHPy debug_ctx_CallTupleDict(HPyContext *dctx, DHPy callable, DHPy args, DHPy kw);
 DHPy debug_ctx_Call(HPyContext *dctx, DHPy callable, const DHPy *args, size_t nargs, DHPy kwnames);
 DHPy debug_ctx_CallMethod(HPyContext *dctx, DHPy name, const DHPy *args, size_t nargs, DHPy kwnames);
+DHPy debug_ctx_CallMethodCached(HPyContext *dctx, HPyCallSite *site, const DHPy *args, size_t nargs);
 DHPy debug_ctx_GetIter(HPyContext *dctx, DHPy obj);
 DHPy debug_ctx_Iter_Next(HPyContext *dctx, DHPy obj);
 int debug_ctx_Iter_Check(HPyContext *dctx, DHPy obj);
+HPy_ssize_t debug_ctx_Iter_NextBatch(HPyContext *dctx, DHPy obj, DHPy *items, HPy_ssize_t n);
 void debug_ctx_FatalError(HPyContext *dctx, const char *message);
 void debug_ctx_Err_SetString(HPyContext *dctx, DHPy h_type, const char *utf8_message);
 void debug_ctx_Err_SetObject(HPyContext *dctx, DHPy h_type, DHPy h_value);
@@ -125,6 +129,7 @@ void *debug_ctx_AsStruct_List(HPyContext *dctx, DHPy h);
 void *debug_ctx_AsStruct_Dict(HPyContext *dctx, DHPy h);
 HPyType_BuiltinShape debug_ctx_Type_GetBuiltinShape(HPyContext *dctx, DHPy h_type);
 DHPy debug_ctx_New(HPyContext *dctx, DHPy h_type, void **data);
+DHPy debug_ctx_StructSequence_New(HPyContext *dctx, DHPy type, HPy_ssize_t nargs, const DHPy *args);
 DHPy debug_ctx_Repr(HPyContext *dctx, DHPy obj);
 DHPy debug_ctx_Str(HPyContext *dctx, DHPy obj);
 DHPy debug_ctx_ASCII(HPyContext *dctx, DHPy obj);
@@ -132,6 +137,10 @@ DHPy debug_ctx_Bytes(HPyContext *dctx, DHPy obj);
 DHPy debug_ctx_RichCompare(HPyContext *dctx, DHPy v, DHPy w, int op);
 int debug_ctx_RichCompareBool(HPyContext *dctx, DHPy v, DHPy w, int op);
 HPy_hash_t debug_ctx_Hash(HPyContext *dctx, DHPy obj);
+int debug_ctx_GetBuffer(HPyContext *dctx, DHPy obj, HPy_buffer *view, int flags);
+void debug_ctx_Buffer_Release(HPyContext *dctx, HPy_buffer *view);
+int debug_ctx_Buffer_IsContiguous(HPyContext *dctx, const HPy_buffer *view, char order);
+int debug_ctx_Buffer_ToContiguous(HPyContext *dctx, void *buf, const HPy_buffer *view, HPy_ssize_t len, char order);
 int debug_ctx_Bytes_Check(HPyContext *dctx, DHPy h);
 HPy_ssize_t debug_ctx_Bytes_Size(HPyContext *dctx, DHPy h);
 HPy_ssize_t debug_ctx_Bytes_GET_SIZE(HPyContext *dctx, DHPy h);
@@ -162,6 +171,7 @@ int debug_ctx_Dict_Check(HPyContext *dctx, DHPy h);
 DHPy debug_ctx_Dict_New(HPyContext *dctx);
 DHPy debug_ctx_Dict_Keys(HPyContext *dctx, DHPy h);
 DHPy debug_ctx_Dict_Copy(HPyContext *dctx, DHPy h);
+int debug_ctx_Dict_Next(HPyContext *dctx, DHPy h, HPy_ssize_t *pos, DHPy *key, DHPy *value);
 int debug_ctx_Tuple_Check(HPyContext *dctx, DHPy h);
 DHPy debug_ctx_Tuple_FromArray(HPyContext *dctx, const DHPy items[], HPy_ssize_t n);
 DHPy debug_ctx_Slice_New(HPyContext *dctx, DHPy start, DHPy stop, DHPy step);
@@ -182,12 +192,20 @@ HPyTupleBuilder debug_ctx_TupleBuilder_New(HPyContext *dctx, HPy_ssize_t size);
 void debug_ctx_TupleBuilder_Set(HPyContext *dctx, HPyTupleBuilder builder, HPy_ssize_t index, DHPy h_item);
 DHPy debug_ctx_TupleBuilder_Build(HPyContext *dctx, HPyTupleBuilder builder);
 void debug_ctx_TupleBuilder_Cancel(HPyContext *dctx, HPyTupleBuilder builder);
+HPyDictBuilder debug_ctx_DictBuilder_New(HPyContext *dctx, HPy_ssize_t size);
+int debug_ctx_DictBuilder_Set(HPyContext *dctx, HPyDictBuilder builder, DHPy h_key, DHPy h_value);
+int debug_ctx_DictBuilder_Set_s(HPyContext *dctx, HPyDictBuilder builder, const char *utf8_key, DHPy h_value);
+DHPy debug_ctx_DictBuilder_Build(HPyContext *dctx, HPyDictBuilder builder);
+void debug_ctx_DictBuilder_Cancel(HPyContext *dctx, HPyDictBuilder builder);
 HPyTracker debug_ctx_Tracker_New(HPyContext *dctx, HPy_ssize_t size);
 int debug_ctx_Tracker_Add(HPyContext *dctx, HPyTracker ht, DHPy h);
 void debug_ctx_Tracker_ForgetAll(HPyContext *dctx, HPyTracker ht);
 void debug_ctx_Tracker_Close(HPyContext *dctx, HPyTracker ht);
 void debug_ctx_Field_Store(HPyContext *dctx, DHPy target_object, HPyField *target_field, DHPy h);
 DHPy debug_ctx_Field_Load(HPyContext *dctx, DHPy source_object, HPyField source_field);
+void debug_ctx_Field_StoreMany(HPyContext *dctx, DHPy target_object, HPyField **target_fields, const DHPy *hs, HPy_ssize_t n);
+void debug_ctx_Field_LoadMany(HPyContext *dctx, DHPy source_object, HPyField **source_fields, DHPy *out, HPy_ssize_t n);
+void debug_ctx_Field_WriteBarrier(HPyContext *dctx, DHPy target_object);
 void debug_ctx_ReenterPythonExecution(HPyContext *dctx, HPyThreadState state);
 HPyThreadState debug_ctx_LeavePythonExecution(HPyContext *dctx);
 void debug_ctx_Global_Store(HPyContext *dctx, HPyGlobal *global, DHPy h);
@@ -288,6 +306,8 @@ static inline void debug_ctx_init_fields(HPyContext *dctx, HPyContext *uctx)
     dctx->h_Builtins = DHPy_open_immortal(dctx, uctx->h_Builtins);
     dctx->ctx_Dup = &debug_ctx_Dup;
     dctx->ctx_Close = &debug_ctx_Close;
+    dctx->ctx_CloseMany = &debug_ctx_CloseMany;
+    dctx->ctx_DupMany = &debug_ctx_DupMany;
     dctx->ctx_Long_FromInt32_t = &debug_ctx_Long_FromInt32_t;
     dctx->ctx_Long_FromUInt32_t = &debug_ctx_Long_FromUInt32_t;
     dctx->ctx_Long_FromInt64_t = &debug_ctx_Long_FromInt64_t;
@@ -347,9 +367,11 @@ static inline void debug_ctx_init_fields(HPyContext *dctx, HPyContext *uctx)
     dctx->ctx_CallTupleDict = &debug_ctx_CallTupleDict;
     dctx->ctx_Call = &debug_ctx_Call;
     dctx->ctx_CallMethod = &debug_ctx_CallMethod;
+    dctx->ctx_CallMethodCached = &debug_ctx_CallMethodCached;
     dctx->ctx_GetIter = &debug_ctx_GetIter;
     dctx->ctx_Iter_Next = &debug_ctx_Iter_Next;
     dctx->ctx_Iter_Check = &debug_ctx_Iter_Check;
+    dctx->ctx_Iter_NextBatch = &debug_ctx_Iter_NextBatch;
     dctx->ctx_FatalError = &debug_ctx_FatalError;
     dctx->ctx_Err_SetString = &debug_ctx_Err_SetString;
     dctx->ctx_Err_SetObject = &debug_ctx_Err_SetObject;
@@ -401,6 +423,7 @@ static inline void debug_ctx_init_fields(HPyContext *dctx, HPyContext *uctx)
     dctx->ctx_AsStruct_Dict = &debug_ctx_AsStruct_Dict;
     dctx->ctx_Type_GetBuiltinShape = &debug_ctx_Type_GetBuiltinShape;
     dctx->ctx_New = &debug_ctx_New;
+    dctx->ctx_StructSequence_New = &debug_ctx_StructSequence_New;
     dctx->ctx_Repr = &debug_ctx_Repr;
     dctx->ctx_Str = &debug_ctx_Str;
     dctx->ctx_ASCII = &debug_ctx_ASCII;
@@ -408,6 +431,10 @@ static inline void debug_ctx_init_fields(HPyContext *dctx, HPyContext *uctx)
     dctx->ctx_RichCompare = &debug_ctx_RichCompare;
     dctx->ctx_RichCompareBool = &debug_ctx_RichCompareBool;
     dctx->ctx_Hash = &debug_ctx_Hash;
+    dctx->ctx_GetBuffer = &debug_ctx_GetBuffer;
+    dctx->ctx_Buffer_Release = &debug_ctx_Buffer_Release;
+    dctx->ctx_Buffer_IsContiguous = &debug_ctx_Buffer_IsContiguous;
+    dctx->ctx_Buffer_ToContiguous = &debug_ctx_Buffer_ToContiguous;
     dctx->ctx_Bytes_Check = &debug_ctx_Bytes_Check;
     dctx->ctx_Bytes_Size = &debug_ctx_Bytes_Size;
     dctx->ctx_Bytes_GET_SIZE = &debug_ctx_Bytes_GET_SIZE;
@@ -438,6 +465,7 @@ static inline void debug_ctx_init_fields(HPyContext *dctx, HPyContext *uctx)
     dctx->ctx_Dict_New = &debug_ctx_Dict_New;
     dctx->ctx_Dict_Keys = &debug_ctx_Dict_Keys;
     dctx->ctx_Dict_Copy = &debug_ctx_Dict_Copy;
+    dctx->ctx_Dict_Next = &debug_ctx_Dict_Next;
     dctx->ctx_Tuple_Check = &debug_ctx_Tuple_Check;
     dctx->ctx_Tuple_FromArray = &debug_ctx_Tuple_FromArray;
     dctx->ctx_Slice_New = &debug_ctx_Slice_New;
@@ -458,12 +486,20 @@ static inline void debug_ctx_init_fields(HPyContext *dctx, HPyContext *uctx)
     dctx->ctx_TupleBuilder_Set = &debug_ctx_TupleBuilder_Set;
     dctx->ctx_TupleBuilder_Build = &debug_ctx_TupleBuilder_Build;
     dctx->ctx_TupleBuilder_Cancel = &debug_ctx_TupleBuilder_Cancel;
+    dctx->ctx_DictBuilder_New = &debug_ctx_DictBuilder_New;
+    dctx->ctx_DictBuilder_Set = &debug_ctx_DictBuilder_Set;
+    dctx->ctx_DictBuilder_Set_s = &debug_ctx_DictBuilder_Set_s;
+    dctx->ctx_DictBuilder_Build = &debug_ctx_DictBuilder_Build;
+    dctx->ctx_DictBuilder_Cancel = &debug_ctx_DictBuilder_Cancel;
     dctx->ctx_Tracker_New = &debug_ctx_Tracker_New;
     dctx->ctx_Tracker_Add = &debug_ctx_Tracker_Add;
     dctx->ctx_Tracker_ForgetAll = &debug_ctx_Tracker_ForgetAll;
     dctx->ctx_Tracker_Close = &debug_ctx_Tracker_Close;
     dctx->ctx_Field_Store = &debug_ctx_Field_Store;
     dctx->ctx_Field_Load = &debug_ctx_Field_Load;
+    dctx->ctx_Field_StoreMany = &debug_ctx_Field_StoreMany;
+    dctx->ctx_Field_LoadMany = &debug_ctx_Field_LoadMany;
+    dctx->ctx_Field_WriteBarrier = &debug_ctx_Field_WriteBarrier;
     dctx->ctx_ReenterPythonExecution = &debug_ctx_ReenterPythonExecution;
     dctx->ctx_LeavePythonExecution = &debug_ctx_LeavePythonExecution;
     dctx->ctx_Global_Store = &debug_ctx_Global_Store;
@@ -1305,6 +1305,28 @@ HPy_hash_t debug_ctx_Hash(HPyContext *dctx, DHPy obj)
     return universal_result;
 }
 
+int debug_ctx_Buffer_IsContiguous(HPyContext *dctx, const HPy_buffer *view, char order)
+{
+    if (!get_ctx_info(dctx)->is_valid) {
+        report_invalid_debug_context();
+    }
+    get_ctx_info(dctx)->is_valid = false;
+    int universal_result = HPyBuffer_IsContiguous(get_info(dctx)->uctx, view, order);
+    get_ctx_info(dctx)->is_valid = true;
+    return universal_result;
+}
+
+int debug_ctx_Buffer_ToContiguous(HPyContext *dctx, void *buf, const HPy_buffer *view, HPy_ssize_t len, char order)
+{
+    if (!get_ctx_info(dctx)->is_valid) {
+        report_invalid_debug_context();
+    }
+    get_ctx_info(dctx)->is_valid = false;
+    int universal_result = HPyBuffer_ToContiguous(get_info(dctx)->uctx, buf, view, len, order);
+    get_ctx_info(dctx)->is_valid = true;
+    return universal_result;
+}
+
 int debug_ctx_Bytes_Check(HPyContext *dctx, DHPy h)
 {
     if (!get_ctx_info(dctx)->is_valid) {
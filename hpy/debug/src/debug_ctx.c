@@ -81,9 +81,15 @@ int hpy_debug_ctx_init(HPyContext *dctx, HPyContext *uctx)
     info->protected_raw_data_max_size = DEFAULT_PROTECTED_RAW_DATA_MAX_SIZE;
     info->handle_alloc_stacktrace_limit = 0;
     info->protected_raw_data_size = 0;
+    info->raw_data_pool_max_size = 0;
+    info->raw_data_sample_period = 0;
+    info->raw_data_sample_counter = 0;
+    DHRawPool_init(&info->raw_data_pool);
     DHQueue_init(&info->open_handles);
     DHQueue_init(&info->closed_handles);
     DHQueue_init(&info->closed_builder);
+    DHSlab_init(&info->handle_slab, sizeof(DebugHandle));
+    DHSlab_init(&info->builder_slab, sizeof(DebugBuilderHandle));
     debug_ctx_init_fields(dctx, uctx);
     if (init_dctx_cache(dctx, info) != 0) {
         return -1;
@@ -191,16 +197,104 @@ void debug_ctx_Close(HPyContext *dctx, DHPy dh)
     get_ctx_info(dctx)->is_valid = true;
 }
 
+void debug_ctx_CloseMany(HPyContext *dctx, const DHPy *dhs, HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++)
+        debug_ctx_Close(dctx, dhs[i]);
+}
+
+/* Each handle gets its own debug handle, so that leaks and double closes
+   are reported for the single handles exactly like with HPy_Dup */
+void debug_ctx_DupMany(HPyContext *dctx, const DHPy *dhs, DHPy *out,
+                       HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++)
+        out[i] = debug_ctx_Dup(dctx, dhs[i]);
+}
+
+void debug_ctx_Field_StoreMany(HPyContext *dctx, DHPy target_object,
+                               HPyField **target_fields, const DHPy *hs,
+                               HPy_ssize_t n)
+{
+    if (!get_ctx_info(dctx)->is_valid) {
+        report_invalid_debug_context();
+    }
+    UHPy uh_target_object = DHPy_unwrap(dctx, target_object);
+    UHPy *uhs = (UHPy *)alloca(n * sizeof(UHPy));
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        uhs[i] = DHPy_unwrap(dctx, hs[i]);
+    }
+    get_ctx_info(dctx)->is_valid = false;
+    HPyField_StoreMany(get_info(dctx)->uctx, uh_target_object, target_fields,
+                       uhs, n);
+    get_ctx_info(dctx)->is_valid = true;
+}
+
+void debug_ctx_Field_LoadMany(HPyContext *dctx, DHPy source_object,
+                              HPyField **source_fields, DHPy *out,
+                              HPy_ssize_t n)
+{
+    if (!get_ctx_info(dctx)->is_valid) {
+        report_invalid_debug_context();
+    }
+    UHPy uh_source_object = DHPy_unwrap(dctx, source_object);
+    get_ctx_info(dctx)->is_valid = false;
+    HPyField_LoadMany(get_info(dctx)->uctx, uh_source_object, source_fields,
+                      out, n);
+    get_ctx_info(dctx)->is_valid = true;
+    // 'out' now contains universal handles: wrap them in place
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        out[i] = DHPy_open(dctx, out[i]);
+    }
+}
+
+/* The write barrier is executed by the universal context, when the debug
+   context forwards the stores to it. This is only called if an extension
+   calls the member directly. */
+void debug_ctx_Field_WriteBarrier(HPyContext *dctx, DHPy target_object)
+{
+    HPyContext *uctx = get_info(dctx)->uctx;
+    if (uctx->ctx_Field_WriteBarrier != NULL)
+        uctx->ctx_Field_WriteBarrier(uctx, DHPy_unwrap(dctx, target_object));
+}
+
+/* Return true if the copy of 'data_size' bytes should go to the raw data
+   pool instead of being page protected */
+static bool use_raw_data_pool(HPyDebugInfo *info, HPy_ssize_t data_size)
+{
+    if (data_size > info->raw_data_pool_max_size)
+        return false;
+    if (info->raw_data_sample_period > 0 &&
+            ++info->raw_data_sample_counter >= info->raw_data_sample_period) {
+        info->raw_data_sample_counter = 0;
+        return false;
+    }
+    return true;
+}
+
 static void *
-protect_and_associate_data_ptr(DHPy h, void *ptr, HPy_ssize_t data_size)
+protect_and_associate_data_ptr(HPyContext *dctx, DHPy h, void *ptr,
+                               HPy_ssize_t data_size)
 {
     DebugHandle *handle = as_DebugHandle(h);
     void *new_ptr;
     if (ptr != NULL)
     {
-        new_ptr = raw_data_copy(ptr, data_size, true);
+        HPyDebugInfo *info = get_info(dctx);
+        bool pooled = use_raw_data_pool(info, data_size);
+        if (pooled)
+            new_ptr = DHRawPool_copy(&info->raw_data_pool, ptr, data_size);
+        else
+            new_ptr = raw_data_copy(ptr, data_size, true);
+        if (new_ptr == NULL) {
+            handle->associated_data = NULL;
+            handle->associated_data_size = 0;
+            HPyErr_NoMemory(info->uctx);
+            return NULL;
+        }
         handle->associated_data = new_ptr;
         handle->associated_data_size = data_size;
+        handle->associated_data_pooled = pooled;
         return new_ptr;
     }
     else
@@ -221,7 +315,7 @@ const char *debug_ctx_Unicode_AsUTF8AndSize(HPyContext *dctx, DHPy h, HPy_ssize_
     if (ptr != NULL) {
         data_size = size != NULL ? *size + 1 : (HPy_ssize_t) strlen(ptr) + 1;
     }
-    return (const char *)protect_and_associate_data_ptr(h, (void *)ptr, data_size);
+    return (const char *)protect_and_associate_data_ptr(dctx, h, (void *)ptr, data_size);
 }
 
 const char *debug_ctx_Bytes_AsString(HPyContext *dctx, DHPy h)
@@ -237,7 +331,7 @@ const char *debug_ctx_Bytes_AsString(HPyContext *dctx, DHPy h)
         // '+ 1' accountd for the implicit null byte termination
         data_size = HPyBytes_Size(uctx, uh) + 1;
     }
-    return (const char *)protect_and_associate_data_ptr(h, (void *)ptr, data_size);
+    return (const char *)protect_and_associate_data_ptr(dctx, h, (void *)ptr, data_size);
 }
 
 const char *debug_ctx_Bytes_AS_STRING(HPyContext *dctx, DHPy h)
@@ -253,7 +347,7 @@ const char *debug_ctx_Bytes_AS_STRING(HPyContext *dctx, DHPy h)
         // '+ 1' accountd for the implicit null byte termination
         data_size = HPyBytes_GET_SIZE(uctx, uh) + 1;
     }
-    return (const char *)protect_and_associate_data_ptr(h, (void *)ptr, data_size);
+    return (const char *)protect_and_associate_data_ptr(dctx, h, (void *)ptr, data_size);
 }
 
 DHPy debug_ctx_Tuple_FromArray(HPyContext *dctx, const DHPy dh_items[], HPy_ssize_t n)
@@ -268,6 +362,21 @@ DHPy debug_ctx_Tuple_FromArray(HPyContext *dctx, const DHPy dh_items[], HPy_ssiz
     return DHPy_open(dctx, HPyTuple_FromArray(get_info(dctx)->uctx, uh_items, n));
 }
 
+DHPy debug_ctx_StructSequence_New(HPyContext *dctx, DHPy dh_type,
+                                  HPy_ssize_t nargs, const DHPy *dh_args)
+{
+    if (!get_ctx_info(dctx)->is_valid) {
+        report_invalid_debug_context();
+    }
+    UHPy uh_type = DHPy_unwrap(dctx, dh_type);
+    UHPy *uh_args = (UHPy *)alloca(nargs * sizeof(UHPy));
+    for(int i=0; i<nargs; i++) {
+        uh_args[i] = DHPy_unwrap(dctx, dh_args[i]);
+    }
+    return DHPy_open(dctx, _HPyStructSequence_New(get_info(dctx)->uctx,
+                                                  uh_type, nargs, uh_args));
+}
+
 DHPy debug_ctx_Type_GenericNew(HPyContext *dctx, DHPy dh_type, const DHPy *dh_args,
                                HPy_ssize_t nargs, DHPy dh_kw)
 {
@@ -508,6 +617,47 @@ void debug_ctx_TupleBuilder_Cancel(HPyContext *dctx, HPyTupleBuilder dh_builder)
     DHPy_builder_handle_close(dctx, handle);
 }
 
+HPyDictBuilder debug_ctx_DictBuilder_New(HPyContext *dctx, HPy_ssize_t size)
+{
+    return DHPyDictBuilder_open(dctx, HPyDictBuilder_New(get_info(dctx)->uctx, size));
+}
+
+int debug_ctx_DictBuilder_Set(HPyContext *dctx, HPyDictBuilder builder, DHPy h_key, DHPy h_value)
+{
+    return HPyDictBuilder_Set(get_info(dctx)->uctx, DHPyDictBuilder_unwrap(dctx, builder),
+                              DHPy_unwrap(dctx, h_key), DHPy_unwrap(dctx, h_value));
+}
+
+int debug_ctx_DictBuilder_Set_s(HPyContext *dctx, HPyDictBuilder builder, const char *utf8_key, DHPy h_value)
+{
+    return HPyDictBuilder_Set_s(get_info(dctx)->uctx, DHPyDictBuilder_unwrap(dctx, builder),
+                                utf8_key, DHPy_unwrap(dctx, h_value));
+}
+
+DHPy debug_ctx_DictBuilder_Build(HPyContext *dctx, HPyDictBuilder dh_builder)
+{
+    HPyContext *uctx = get_info(dctx)->uctx;
+    DebugBuilderHandle *handle = DHPyDictBuilder_as_DebugBuilderHandle(dh_builder);
+    if (handle == NULL) {
+        // HPyDictBuilder_New (or the debug handle) ran out of memory
+        HPyErr_NoMemory(uctx);
+        return HPy_NULL;
+    }
+    UHPy uh_result = HPyDictBuilder_Build(uctx, DHPyDictBuilder_unwrap(dctx, dh_builder));
+    DHPy_builder_handle_close(dctx, handle);
+    return DHPy_open(dctx, uh_result);
+}
+
+void debug_ctx_DictBuilder_Cancel(HPyContext *dctx, HPyDictBuilder dh_builder)
+{
+    DebugBuilderHandle *handle = DHPyDictBuilder_as_DebugBuilderHandle(dh_builder);
+    if (handle == NULL)
+        return;
+    HPyContext *uctx = get_info(dctx)->uctx;
+    HPyDictBuilder_Cancel(uctx, DHPyDictBuilder_unwrap(dctx, dh_builder));
+    DHPy_builder_handle_close(dctx, handle);
+}
+
 /*
    However, we don't want to raise an exception if you pass a non-type,
    because the CPython version (PyObject_TypeCheck) always succeed and it
@@ -563,7 +713,7 @@ const char *debug_ctx_Type_GetName(HPyContext *dctx, DHPy type)
     const char *name = HPyType_GetName(uctx, uh_type);
     ctx_info->is_valid = true;
     n_name = strlen(name) + 1;
-    return (const char *)protect_and_associate_data_ptr(type, (void *)name, n_name);
+    return (const char *)protect_and_associate_data_ptr(dctx, type, (void *)name, n_name);
 }
 
 int debug_ctx_Type_IsSubtype(HPyContext *dctx, DHPy sub, DHPy type)
@@ -685,3 +835,154 @@ DHPy debug_ctx_CallMethod(HPyContext *dctx,  DHPy dh_name, const DHPy *dh_args,
     ctx_info->is_valid = true;
     return dh_result;
 }
+
+DHPy debug_ctx_CallMethodCached(HPyContext *dctx, HPyCallSite *site, const DHPy *dh_args, size_t nargs)
+{
+    HPyDebugCtxInfo *ctx_info;
+    HPyContext *uctx;
+
+    ctx_info = get_ctx_info(dctx);
+    if (!ctx_info->is_valid) {
+        report_invalid_debug_context();
+    }
+
+    uctx = ctx_info->info->uctx;
+    if (site == NULL || site->name == NULL) {
+        HPy_FatalError(uctx, "HPy_CallMethodCached arg 'site' must be an initialized HPyCallSite");
+    }
+    if (nargs < 1) {
+        HPy_FatalError(uctx, "HPy_CallMethodCached arg 'nargs' must include the receiver");
+    }
+    size_t nkw = 0;
+    if (site->kwnames != NULL) {
+        while (site->kwnames[nkw] != NULL)
+            nkw++;
+    }
+    const size_t n_all_args = nargs + nkw;
+    UHPy *uh_args = (UHPy *)alloca(n_all_args * sizeof(UHPy));
+    for(size_t i=0; i < n_all_args; i++) {
+        uh_args[i] = DHPy_unwrap(dctx, dh_args[i]);
+    }
+    ctx_info->is_valid = false;
+    DHPy dh_result = DHPy_open(dctx, HPy_CallMethodCached(uctx, site, uh_args, nargs));
+    ctx_info->is_valid = true;
+    return dh_result;
+}
+
+HPy_ssize_t debug_ctx_Iter_NextBatch(HPyContext *dctx, DHPy dh_obj, DHPy *dh_items, HPy_ssize_t n)
+{
+    HPyDebugCtxInfo *ctx_info;
+    HPyContext *uctx;
+
+    ctx_info = get_ctx_info(dctx);
+    if (!ctx_info->is_valid) {
+        report_invalid_debug_context();
+    }
+
+    uctx = ctx_info->info->uctx;
+    UHPy uh_obj = DHPy_unwrap(dctx, dh_obj);
+    if (n <= 0) {
+        return HPyIter_NextBatch(uctx, uh_obj, NULL, n);
+    }
+    UHPy *uh_items = (UHPy *)malloc(n * sizeof(UHPy));
+    if (uh_items == NULL) {
+        HPyErr_NoMemory(uctx);
+        return -1;
+    }
+    ctx_info->is_valid = false;
+    HPy_ssize_t result = HPyIter_NextBatch(uctx, uh_obj, uh_items, n);
+    ctx_info->is_valid = true;
+    for (HPy_ssize_t i = 0; i < result; i++) {
+        dh_items[i] = DHPy_open(dctx, uh_items[i]);
+    }
+    free(uh_items);
+    return result;
+}
+
+/* The debug mode gives the caller its own copy of the view: 'obj' is a
+   debug handle and 'internal' points to the view of the universal context,
+   which is needed to release it. So, if a view is never released, the handle
+   of its 'obj' is reported as a leak. */
+int debug_ctx_GetBuffer(HPyContext *dctx, DHPy dh_obj, HPy_buffer *view, int flags)
+{
+    HPyDebugCtxInfo *ctx_info;
+    HPyContext *uctx;
+
+    ctx_info = get_ctx_info(dctx);
+    if (!ctx_info->is_valid) {
+        report_invalid_debug_context();
+    }
+
+    uctx = ctx_info->info->uctx;
+    HPy_buffer *uview = (HPy_buffer *)malloc(sizeof(HPy_buffer));
+    if (uview == NULL) {
+        HPyErr_NoMemory(uctx);
+        view->obj = HPy_NULL;
+        return -1;
+    }
+    UHPy uh_obj = DHPy_unwrap(dctx, dh_obj);
+    ctx_info->is_valid = false;
+    int res = HPy_GetBuffer(uctx, uh_obj, uview, flags);
+    ctx_info->is_valid = true;
+    if (res < 0) {
+        free(uview);
+        view->obj = HPy_NULL;
+        return -1;
+    }
+    *view = *uview;
+    view->obj = DHPy_open(dctx, uview->obj);
+    view->internal = uview;
+    return 0;
+}
+
+void debug_ctx_Buffer_Release(HPyContext *dctx, HPy_buffer *view)
+{
+    HPyDebugCtxInfo *ctx_info;
+    HPyContext *uctx;
+
+    ctx_info = get_ctx_info(dctx);
+    if (!ctx_info->is_valid) {
+        report_invalid_debug_context();
+    }
+
+    uctx = ctx_info->info->uctx;
+    HPy_buffer *uview = (HPy_buffer *)view->internal;
+    if (uview == NULL) {
+        HPy_FatalError(uctx, "HPyBuffer_Release called on a view which was "
+                       "already released or not obtained with HPy_GetBuffer");
+    }
+    DHPy_close(dctx, view->obj);
+    view->obj = HPy_NULL;
+    view->internal = NULL;
+    ctx_info->is_valid = false;
+    HPyBuffer_Release(uctx, uview);
+    ctx_info->is_valid = true;
+    free(uview);
+}
+
+int debug_ctx_Dict_Next(HPyContext *dctx, DHPy dh, HPy_ssize_t *pos,
+                        DHPy *dh_key, DHPy *dh_value)
+{
+    HPyDebugCtxInfo *ctx_info;
+    HPyContext *uctx;
+
+    ctx_info = get_ctx_info(dctx);
+    if (!ctx_info->is_valid) {
+        report_invalid_debug_context();
+    }
+
+    uctx = ctx_info->info->uctx;
+    UHPy uh = DHPy_unwrap(dctx, dh);
+    UHPy uh_key, uh_value;
+    ctx_info->is_valid = false;
+    int res = HPyDict_Next(uctx, uh, pos, dh_key ? &uh_key : NULL,
+                           dh_value ? &uh_value : NULL);
+    ctx_info->is_valid = true;
+    if (res > 0) {
+        if (dh_key != NULL)
+            *dh_key = DHPy_open(dctx, uh_key);
+        if (dh_value != NULL)
+            *dh_value = DHPy_open(dctx, uh_value);
+    }
+    return res;
+}
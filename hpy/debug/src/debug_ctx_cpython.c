@@ -74,9 +74,8 @@ static void _buffer_py2h(HPyContext *dctx, const Py_buffer *src, HPy_buffer *des
 static HPyContext* _switch_to_next_dctx_from_cache(HPyContext *current_dctx) {
     HPyContext *next_dctx = hpy_debug_get_next_dctx_from_cache(current_dctx);
     if (next_dctx == NULL) {
+        // 'current_dctx' stays valid: the caller returns to CPython with it
         HPyErr_NoMemory(current_dctx);
-        get_ctx_info(current_dctx)->is_valid = false;
-        get_ctx_info(next_dctx)->is_valid = true;
         return NULL;
     }
     get_ctx_info(current_dctx)->is_valid = false;
@@ -153,6 +152,44 @@ void debug_ctx_CallRealFunctionFromTrampoline(HPyContext *dctx,
         DHPy_close(dctx, dh_result);
         return;
     }
+    case HPyFunc_KWTABLE: {
+        HPyFunc_kwtable f = (HPyFunc_kwtable)func;
+        _HPyFunc_args_KWTABLE *a = (_HPyFunc_args_KWTABLE*)args;
+        HPy_ssize_t n = a->kwtable->nparams;
+        PyObject **params = (PyObject **)alloca(n * sizeof(PyObject *));
+        if (_HPyKwTable_PlaceArgs(a->kwtable, a->args, a->nargsf, a->kwnames,
+                                  params) < 0) {
+            a->result = NULL;
+            return;
+        }
+        DHPy dh_self = _py2dh(dctx, a->self);
+        DHPy *dh_args = (DHPy *)alloca(n * sizeof(DHPy));
+        for (HPy_ssize_t i = 0; i < n; i++) {
+            dh_args[i] = _py2dh(dctx, params[i]);
+        }
+
+        HPyContext *next_dctx = _switch_to_next_dctx_from_cache(dctx);
+        if (next_dctx == NULL) {
+            DHPy_close(dctx, dh_self);
+            for (HPy_ssize_t i = 0; i < n; i++) {
+                DHPy_close(dctx, dh_args[i]);
+            }
+            a->result = NULL;
+            return;
+        }
+
+        DHPy dh_result = f(next_dctx, dh_self, dh_args, n);
+
+        _switch_back_to_original_dctx(dctx, next_dctx);
+
+        DHPy_close_and_check(dctx, dh_self);
+        for (HPy_ssize_t i = 0; i < n; i++) {
+            DHPy_close_and_check(dctx, dh_args[i]);
+        }
+        a->result = _dh2py(dctx, dh_result);
+        DHPy_close(dctx, dh_result);
+        return;
+    }
     case HPyFunc_INITPROC: {
         HPyFunc_initproc f = (HPyFunc_initproc)func;
         _HPyFunc_args_INITPROC *a = (_HPyFunc_args_INITPROC*)args;
@@ -292,6 +329,70 @@ void debug_ctx_CallRealFunctionFromTrampoline(HPyContext *dctx,
         DHPy_close(dctx, dh_result);
         return;
     }
+    case HPyFunc_ITERNEXTBATCHFUNC: {
+        HPyFunc_iternextbatchfunc f = (HPyFunc_iternextbatchfunc)func;
+        _HPyFunc_args_ITERNEXTBATCHFUNC *a = (_HPyFunc_args_ITERNEXTBATCHFUNC*)args;
+        // 'n' is not bounded, so we cannot use alloca as for VARARGS
+        DHPy *dh_items = (DHPy *)malloc(a->n * sizeof(DHPy));
+        if (dh_items == NULL) {
+            PyErr_NoMemory();
+            a->result = -1;
+            return;
+        }
+        DHPy dh_self = _py2dh(dctx, a->self);
+
+        HPyContext *next_dctx = _switch_to_next_dctx_from_cache(dctx);
+        if (next_dctx == NULL) {
+            DHPy_close(dctx, dh_self);
+            free(dh_items);
+            a->result = -1;
+            return;
+        }
+
+        a->result = f(next_dctx, dh_self, dh_items, a->n);
+
+        _switch_back_to_original_dctx(dctx, next_dctx);
+
+        DHPy_close_and_check(dctx, dh_self);
+        if (a->result < -1 || a->result > a->n)
+            Py_FatalError("HPy_tp_iternext_batch returned an invalid number of items");
+        for (HPy_ssize_t i = 0; i < a->result; i++) {
+            a->items[i] = _dh2py(dctx, dh_items[i]);
+            DHPy_close(dctx, dh_items[i]);
+        }
+        free(dh_items);
+        return;
+    }
+    case HPyFunc_SENDFUNC: {
+        HPyFunc_sendfunc f = (HPyFunc_sendfunc)func;
+        _HPyFunc_args_SENDFUNC *a = (_HPyFunc_args_SENDFUNC*)args;
+        DHPy dh_self = _py2dh(dctx, a->self);
+        DHPy dh_value = _py2dh(dctx, a->value);
+        DHPy dh_result = HPy_NULL;
+
+        HPyContext *next_dctx = _switch_to_next_dctx_from_cache(dctx);
+        if (next_dctx == NULL) {
+            DHPy_close(dctx, dh_self);
+            DHPy_close(dctx, dh_value);
+            *a->presult = NULL;
+            a->result = HPySend_ERROR;
+            return;
+        }
+
+        a->result = f(next_dctx, dh_self, dh_value, &dh_result);
+
+        _switch_back_to_original_dctx(dctx, next_dctx);
+
+        DHPy_close_and_check(dctx, dh_self);
+        DHPy_close_and_check(dctx, dh_value);
+        if (a->result != HPySend_ERROR && HPy_IsNull(dh_result))
+            Py_FatalError("HPy_am_send must set 'result' unless it returns HPySend_ERROR");
+        if (a->result == HPySend_ERROR && !HPy_IsNull(dh_result))
+            Py_FatalError("HPy_am_send must not set 'result' if it returns HPySend_ERROR");
+        *a->presult = _dh2py(dctx, dh_result);
+        DHPy_close(dctx, dh_result);
+        return;
+    }
 #include "autogen_debug_ctx_call.i"
     default:
         Py_FatalError("Unsupported HPyFunc_Signature in debug_ctx_cpython.c");
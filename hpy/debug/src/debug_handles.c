@@ -19,12 +19,25 @@ static void debug_handles_sanity_check(HPyDebugInfo *info)
 #endif
 }
 
+static void DebugHandle_check_pooled_raw_data(HPyDebugInfo *info, DebugHandle *handle) {
+    if (!DHRawPool_check(handle->associated_data, handle->associated_data_size)) {
+        HPy_FatalError(info->uctx,
+            "Invalid write to the read-only data associated with a handle "
+            "(e.g. the buffer returned by HPyUnicode_AsUTF8AndSize)");
+    }
+}
+
 static void DebugHandle_free_raw_data(HPyDebugInfo *info, DebugHandle *handle, bool was_counted_in_limit) {
     if (handle->associated_data) {
         if (was_counted_in_limit) {
             info->protected_raw_data_size -= handle->associated_data_size;
         }
-        if (raw_data_free(handle->associated_data, handle->associated_data_size)) {
+        if (handle->associated_data_pooled) {
+            DebugHandle_check_pooled_raw_data(info, handle);
+            DHRawPool_free(&info->raw_data_pool, handle->associated_data,
+                           handle->associated_data_size);
+        }
+        else if (raw_data_free(handle->associated_data, handle->associated_data_size)) {
             HPy_FatalError(info->uctx, "HPy could not free internally allocated memory.");
         }
         handle->associated_data = NULL;
@@ -39,16 +52,17 @@ static DHPy _DHPy_open(HPyContext *dctx, UHPy uh, bool is_immortal)
     HPyDebugInfo *info = get_info(dctx);
 
     // if the closed_handles queue is full, let's reuse one of those. Else,
-    // malloc a new one
+    // allocate a new one from the slab
     DebugHandle *handle = NULL;
-    if (info->closed_handles.size >= info->closed_handles_queue_max_size) {
+    if (info->closed_handles.size > 0 &&
+            info->closed_handles.size >= info->closed_handles_queue_max_size) {
         handle = (DebugHandle *)DHQueue_popfront(&info->closed_handles);
         DebugHandle_free_raw_data(info, handle, true);
         if (handle->allocation_stacktrace)
             free(handle->allocation_stacktrace);
     }
     else {
-        handle = malloc(sizeof(DebugHandle));
+        handle = DHSlab_alloc(&info->handle_slab);
         if (handle == NULL) {
             return HPyErr_NoMemory(info->uctx);
         }
@@ -65,6 +79,7 @@ static DHPy _DHPy_open(HPyContext *dctx, UHPy uh, bool is_immortal)
     handle->is_immortal = is_immortal;
     handle->associated_data = NULL;
     handle->associated_data_size = 0;
+    handle->associated_data_pooled = false;
     DHQueue_append(&info->open_handles, (DHQueueNode *)handle);
     debug_handles_sanity_check(info);
     return as_DHPy(handle);
@@ -174,6 +189,11 @@ void DHPy_close(HPyContext *dctx, DHPy dh)
         if (new_size > info->protected_raw_data_max_size) {
             // free it now
             DebugHandle_free_raw_data(info, handle, false);
+        } else if (handle->associated_data_pooled) {
+            // the pool cannot protect it: check it now and poison it
+            info->protected_raw_data_size = new_size;
+            DebugHandle_check_pooled_raw_data(info, handle);
+            DHRawPool_protect(handle->associated_data, handle->associated_data_size);
         } else {
             // keep/leak it and make it protected from further reading
             info->protected_raw_data_size = new_size;
@@ -200,7 +220,7 @@ void DHPy_free(HPyContext *dctx, DHPy dh)
     // this is not strictly necessary, but it increases the chances that you
     // get a clear segfault if you use a freed handle
     handle->uh = HPy_NULL;
-    free(handle);
+    DHSlab_free(&info->handle_slab, handle);
 }
 
 static DebugBuilderHandle *debug_builder_handle_open(HPyContext *dctx)
@@ -208,16 +228,17 @@ static DebugBuilderHandle *debug_builder_handle_open(HPyContext *dctx)
     HPyDebugInfo *info = get_info(dctx);
 
     /* If the closed_builder queue is full, let's reuse one of those; otherwise,
-       malloc a new one. */
+       allocate a new one from the slab. */
     DebugBuilderHandle *handle = NULL;
-    if (info->closed_builder.size >= info->closed_handles_queue_max_size) {
+    if (info->closed_builder.size > 0 &&
+            info->closed_builder.size >= info->closed_handles_queue_max_size) {
         handle = (DebugBuilderHandle *)DHQueue_popfront(&info->closed_builder);
     }
     else {
-        handle = malloc(sizeof(DebugBuilderHandle));
+        handle = DHSlab_alloc(&info->builder_slab);
         if (handle == NULL) {
             /* To be consistent with the contract of
-               'HPy(Tuple|List)Builder_New', don't raise an error here and defer
+               'HPy(Tuple|List|Dict)Builder_New', don't raise an error here and defer
                to the build function. */
             return NULL;
         }
@@ -232,7 +253,7 @@ static DebugBuilderHandle *debug_builder_handle_open(HPyContext *dctx)
  * Closes a ``DebugBuilderHandle`` which means that it is appended to the list
  * of closed builder handles. If the list reached its maximum, the oldest
  * builder handle will be free'd. Note, that the contained builder handle
- * (i.e. ``UHPyTupleBuilder`` or ``UHPyListBuilder``) won't be closed since
+ * (e.g. ``UHPyTupleBuilder`` or ``UHPyListBuilder``) won't be closed since
  * that will be done by the wrapped function.
  */
 void DHPy_builder_handle_close(HPyContext *dctx, DebugBuilderHandle *handle)
@@ -241,7 +262,7 @@ void DHPy_builder_handle_close(HPyContext *dctx, DebugBuilderHandle *handle)
 
     /* This check is needed for a very specific case: calling
        DHPy_builder_handle_close twice on the same handle is considered an
-       error and by default the DHPy(Tuple|List)Builder_unwrap catches the
+       error and by default the DHPy(Tuple|List|Dict)Builder_unwrap catches the
        problem and aborts the process with a HPy_FatalError.
 
        However, we leave the possibility to the user to install a custom hook
@@ -262,7 +283,7 @@ void DHPy_builder_handle_close(HPyContext *dctx, DebugBuilderHandle *handle)
     if (info->closed_builder.size > info->closed_handles_queue_max_size) {
         // we have too many closed builder handles. Let's free the oldest one
         DebugBuilderHandle *oldest = (DebugBuilderHandle *)DHQueue_popfront(&info->closed_builder);
-        free(oldest);
+        DHSlab_free(&info->builder_slab, oldest);
     }
 }
 
@@ -286,6 +307,16 @@ DHPyListBuilder DHPyListBuilder_open(HPyContext *dctx, UHPyListBuilder uh)
     return as_DHPyListBuilder(handle);
 }
 
+DHPyDictBuilder DHPyDictBuilder_open(HPyContext *dctx, UHPyDictBuilder uh)
+{
+    if (DHPyDictBuilder_IsNull(uh))
+        return DHPyDictBuilder_NULL;
+    DebugBuilderHandle *handle = debug_builder_handle_open(dctx);
+    if (handle != NULL)
+        handle->uh.dict_builder = uh;
+    return as_DHPyDictBuilder(handle);
+}
+
 void DHPy_invalid_builder_handle(HPyContext *dctx)
 {
     HPyDebugInfo *info = get_info(dctx);
@@ -37,6 +37,67 @@ void DHQueue_sanity_check(DHQueue *q);
 
 /* === DHQueue === */
 
+/* === DHSlab === */
+
+/**
+ * A simple slab allocator for fixed-size items, used for DebugHandle and
+ * DebugBuilderHandle to avoid a malloc/free pair per handle and to keep
+ * handles close to each other in memory. Freed items are kept in a free list
+ * (linked through the first word of the item) and reused in LIFO order.
+ */
+typedef struct _DHSlabFreeItem_s {
+    struct _DHSlabFreeItem_s *next;
+} DHSlabFreeItem;
+
+typedef struct _DHSlabChunk_s {
+    struct _DHSlabChunk_s *next;
+} DHSlabChunk;
+
+typedef struct {
+    size_t item_size;
+    DHSlabChunk *chunks;
+    DHSlabFreeItem *free_list;
+    char *bump;         // next never-used item in the most recent chunk
+    char *bump_end;
+    HPy_ssize_t n_chunks;
+    HPy_ssize_t n_used;
+} DHSlab;
+
+void DHSlab_init(DHSlab *s, size_t item_size);
+void *DHSlab_alloc(DHSlab *s);
+void DHSlab_free(DHSlab *s, void *item);
+void DHSlab_clear(DHSlab *s);
+HPy_ssize_t DHSlab_capacity(DHSlab *s);
+
+/* === DHSlab === */
+
+/* === DHRawPool === */
+
+/**
+ * A pool for the small copies of raw data associated with debug handles (see
+ * below). The copies are packed into the slabs of a few size classes, instead
+ * of taking at least one page each, and they are guarded by a checksum and
+ * canaries instead of page protection: so, writes are detected only when the
+ * handle is closed or reused, and reads after close return poison instead of
+ * crashing.
+ */
+#define DHRAWPOOL_NCLASSES 4
+#define DHRAWPOOL_MAX_SIZE 256
+
+typedef struct {
+    DHSlab slabs[DHRAWPOOL_NCLASSES];
+} DHRawPool;
+
+void DHRawPool_init(DHRawPool *p);
+void *DHRawPool_copy(DHRawPool *p, const void *data, HPy_ssize_t size);
+bool DHRawPool_check(const void *data, HPy_ssize_t size);
+void DHRawPool_protect(void *data, HPy_ssize_t size);
+void DHRawPool_free(DHRawPool *p, void *data, HPy_ssize_t size);
+HPy_ssize_t DHRawPool_used(DHRawPool *p);
+void DHRawPool_clear(DHRawPool *p);
+
+/* === DHRawPool === */
+
 /* The Debug context is a wrapper around an underlying context, which we will
    call Universal. Inside the debug mode we manipulate handles which belongs
    to both contexts, so to make things easier we create two typedefs to make
@@ -127,6 +188,15 @@ void DHQueue_sanity_check(DHQueue *q);
    different configuration of the limits. For the sake of keeping the
    implementation reasonably simple and portable, we choose to ignore this
    for the time being.
+
+   Copying every small string into its own protected pages is expensive (a
+   few syscalls and at least one page per call), so the user can choose to
+   copy raw data up to `raw_data_pool_max_size` bytes into a DHRawPool
+   instead. The pooled copies cannot be protected from reading: they are
+   checked for writes when the handle is closed and when the copy is freed,
+   and they are poisoned in between. With `raw_data_sample_period` N > 0,
+   every Nth of those copies gets the full protection anyway, so that a long
+   run still has a chance to crash right at the invalid access.
 */
 
 typedef HPy UHPy;
@@ -135,20 +205,27 @@ typedef HPyTupleBuilder UHPyTupleBuilder;
 typedef HPyTupleBuilder DHPyTupleBuilder;
 typedef HPyListBuilder UHPyListBuilder;
 typedef HPyListBuilder DHPyListBuilder;
+typedef HPyDictBuilder UHPyDictBuilder;
+typedef HPyDictBuilder DHPyDictBuilder;
 
 #define DHPyTupleBuilder_IsNull(h) ((h)._tup == 0)
 #define DHPyListBuilder_IsNull(h) ((h)._lst == 0)
+#define DHPyDictBuilder_IsNull(h) ((h)._dict == 0)
 
 #if defined(_MSC_VER) && defined(__cplusplus) // MSVC C4576
 #  define UHPyListBuilder_NULL {0}
 #  define UHPyTupleBuilder_NULL {0}
 #  define DHPyListBuilder_NULL UHPyListBuilder_NULL
 #  define DHPyTupleBuilder_NULL UHPyTupleBuilder_NULL
+#  define UHPyDictBuilder_NULL {0}
+#  define DHPyDictBuilder_NULL UHPyDictBuilder_NULL
 #else
 #  define UHPyListBuilder_NULL ((UHPyListBuilder){0})
 #  define UHPyTupleBuilder_NULL ((UHPyTupleBuilder){0})
 #  define DHPyListBuilder_NULL ((DHPyListBuilder){0})
 #  define DHPyTupleBuilder_NULL ((DHPyTupleBuilder){0})
+#  define UHPyDictBuilder_NULL ((UHPyDictBuilder){0})
+#  define DHPyDictBuilder_NULL ((DHPyDictBuilder){0})
 #endif
 
 /* Under CPython:
@@ -186,6 +263,8 @@ typedef struct DebugHandle {
     long generation;
     bool is_closed:1;
     bool is_immortal:1;
+    // true if associated_data was allocated by the DHRawPool
+    bool associated_data_pooled:1;
     // pointer to and size of any raw data associated with
     // the lifetime of the handle:
     void *associated_data;
@@ -194,12 +273,13 @@ typedef struct DebugHandle {
     HPy_ssize_t associated_data_size;
 } DebugHandle;
 
-/** A debug handle for a tuple or list builder. */
+/** A debug handle for a tuple, list or dict builder. */
 typedef struct DebugBuilderHandle {
     DHQueueNode node;
     union {
         UHPyTupleBuilder tuple_builder;
         UHPyListBuilder list_builder;
+        UHPyDictBuilder dict_builder;
     } uh;
 
     /**
@@ -237,6 +317,16 @@ static inline DHPyListBuilder as_DHPyListBuilder(DebugBuilderHandle *handle) {
     return (DHPyListBuilder){(HPy_ssize_t)handle};
 }
 
+static inline DebugBuilderHandle * DHPyDictBuilder_as_DebugBuilderHandle(DHPyDictBuilder dh) {
+    if (DHPyDictBuilder_IsNull(dh))
+        return NULL;
+    return (DebugBuilderHandle *)dh._dict;
+}
+
+static inline DHPyDictBuilder as_DHPyDictBuilder(DebugBuilderHandle *handle) {
+    return (DHPyDictBuilder){(HPy_ssize_t)handle};
+}
+
 DHPy DHPy_open(HPyContext *dctx, UHPy uh);
 DHPy DHPy_open_immortal(HPyContext *dctx, UHPy uh);
 void DHPy_close(HPyContext *dctx, DHPy dh);
@@ -245,6 +335,7 @@ void DHPy_free(HPyContext *dctx, DHPy dh);
 void DHPy_invalid_handle(HPyContext *dctx, DHPy dh);
 DHPyTupleBuilder DHPyTupleBuilder_open(HPyContext *dctx, UHPyTupleBuilder uh);
 DHPyListBuilder DHPyListBuilder_open(HPyContext *dctx, UHPyListBuilder uh);
+DHPyDictBuilder DHPyDictBuilder_open(HPyContext *dctx, UHPyDictBuilder uh);
 void DHPy_invalid_builder_handle(HPyContext *dctx);
 void DHPy_builder_handle_close(HPyContext *dctx, DebugBuilderHandle *handle);
 
@@ -273,6 +364,7 @@ static inline UHPy DHPy_unwrap(HPyContext *dctx, DHPy dh)
 
 BUILDER_UNWRAP(HPyTupleBuilder, tuple_builder)
 BUILDER_UNWRAP(HPyListBuilder, list_builder)
+BUILDER_UNWRAP(HPyDictBuilder, dict_builder)
 
 /* === HPyDebugInfo === */
 
@@ -316,12 +408,23 @@ typedef struct {
     HPy_ssize_t closed_handles_queue_max_size; // configurable by the user
     HPy_ssize_t protected_raw_data_max_size;
     HPy_ssize_t protected_raw_data_size;
+    // raw data up to this size is copied to raw_data_pool instead of being
+    // page protected, 0 disables the pool (configurable by the user)
+    HPy_ssize_t raw_data_pool_max_size;
+    // if > 0, every Nth copy which would go to the pool is page protected
+    // anyway (configurable by the user)
+    HPy_ssize_t raw_data_sample_period;
+    HPy_ssize_t raw_data_sample_counter;
+    DHRawPool raw_data_pool;
     // Limit for the stack traces captured for allocated handles
     // Value 0 implies that stack traces should not be captured
     HPy_ssize_t handle_alloc_stacktrace_limit;
     DHQueue open_handles;
     DHQueue closed_handles;
     DHQueue closed_builder;
+    // storage for DebugHandle and DebugBuilderHandle, respectively
+    DHSlab handle_slab;
+    DHSlab builder_slab;
 } HPyDebugInfo;
 
 typedef struct {
@@ -0,0 +1,114 @@
+#include <string.h>
+#include "debug_internal.h"
+
+/* Each copy is stored in a slab item of the smallest size class which fits:
+
+       [ checksum | canary ][ data (size bytes) ][ trailer ] ... unused ...
+
+   The checksum covers the data and is computed when the copy is made; after
+   DHRawPool_protect, the data is overwritten with poison and the checksum
+   covers the poison. The canary and the trailer catch writes just before or
+   after the data. */
+
+typedef struct {
+    uint32_t checksum;
+    uint32_t canary;
+} DHRawPoolHeader;
+
+#define DHRAWPOOL_CANARY 0xCA9A21E5u
+#define DHRAWPOOL_TRAILER_SIZE 8
+#define DHRAWPOOL_MIN_SIZE (DHRAWPOOL_MAX_SIZE >> (DHRAWPOOL_NCLASSES - 1))
+
+static const unsigned char trailer[DHRAWPOOL_TRAILER_SIZE] =
+    {0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD};
+
+// same pattern as the generic raw_data_protect in memprotect.c
+static const unsigned char poison[] = {0xBA, 0xD0, 0xDA, 0x7A};
+
+static inline int size_class(HPy_ssize_t size)
+{
+    assert(size <= DHRAWPOOL_MAX_SIZE);
+    int i = 0;
+    while (((HPy_ssize_t)DHRAWPOOL_MIN_SIZE << i) < size)
+        i++;
+    return i;
+}
+
+static inline DHRawPoolHeader *get_header(const void *data)
+{
+    return (DHRawPoolHeader *)((char *)data - sizeof(DHRawPoolHeader));
+}
+
+// FNV-1a: we only need to detect accidental writes
+static uint32_t checksum(const unsigned char *data, HPy_ssize_t size)
+{
+    uint32_t h = 2166136261u;
+    for (HPy_ssize_t i = 0; i < size; i++) {
+        h ^= data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+void DHRawPool_init(DHRawPool *p)
+{
+    for (int i = 0; i < DHRAWPOOL_NCLASSES; i++) {
+        DHSlab_init(&p->slabs[i], sizeof(DHRawPoolHeader) +
+                    ((size_t)DHRAWPOOL_MIN_SIZE << i) + DHRAWPOOL_TRAILER_SIZE);
+    }
+}
+
+/* Return a copy of 'data' or NULL if we run out of memory. 'size' must not
+   be larger than DHRAWPOOL_MAX_SIZE. */
+void *DHRawPool_copy(DHRawPool *p, const void *data, HPy_ssize_t size)
+{
+    DHRawPoolHeader *header = DHSlab_alloc(&p->slabs[size_class(size)]);
+    if (header == NULL)
+        return NULL;
+    unsigned char *new_data = (unsigned char *)(header + 1);
+    memcpy(new_data, data, size);
+    memcpy(new_data + size, trailer, DHRAWPOOL_TRAILER_SIZE);
+    header->canary = DHRAWPOOL_CANARY;
+    header->checksum = checksum(new_data, size);
+    return new_data;
+}
+
+/* Return true if the copy (or its poison) was not modified since the last
+   call to DHRawPool_copy or DHRawPool_protect */
+bool DHRawPool_check(const void *data, HPy_ssize_t size)
+{
+    DHRawPoolHeader *header = get_header(data);
+    return header->canary == DHRAWPOOL_CANARY &&
+           memcmp((const char *)data + size, trailer,
+                  DHRAWPOOL_TRAILER_SIZE) == 0 &&
+           header->checksum == checksum(data, size);
+}
+
+/* Overwrite the copy with poison, so that reading it after the handle was
+   closed is likely to give wrong results */
+void DHRawPool_protect(void *data, HPy_ssize_t size)
+{
+    unsigned char *d = data;
+    for (HPy_ssize_t i = 0; i < size; i++)
+        d[i] = poison[i % sizeof(poison)];
+    get_header(data)->checksum = checksum(d, size);
+}
+
+void DHRawPool_free(DHRawPool *p, void *data, HPy_ssize_t size)
+{
+    DHSlab_free(&p->slabs[size_class(size)], get_header(data));
+}
+
+HPy_ssize_t DHRawPool_used(DHRawPool *p)
+{
+    HPy_ssize_t n = 0;
+    for (int i = 0; i < DHRAWPOOL_NCLASSES; i++)
+        n += p->slabs[i].n_used;
+    return n;
+}
+
+void DHRawPool_clear(DHRawPool *p)
+{
+    for (int i = 0; i < DHRAWPOOL_NCLASSES; i++)
+        DHSlab_clear(&p->slabs[i]);
+}
@@ -0,0 +1,81 @@
+#include "debug_internal.h"
+
+/* Items are carved out of chunks of DHSLAB_CHUNK_ITEMS items each. Chunks are
+   never given back to the system (except by DHSlab_clear), but freed items
+   are always reused before a new chunk is allocated: so, the memory used is
+   bounded by the peak number of live items, which for debug handles is the
+   number of open handles plus closed_handles_queue_max_size. */
+#define DHSLAB_CHUNK_ITEMS 256
+
+/* The items of a chunk start after the header, rounded up so that they are
+   suitably aligned for any of the structs we store in a slab */
+#define DHSLAB_ALIGN 16
+#define DHSLAB_HEADER_SIZE \
+    ((sizeof(DHSlabChunk) + DHSLAB_ALIGN - 1) & ~((size_t)DHSLAB_ALIGN - 1))
+
+/* Like DHQueue, DHSlab is not thread-safe: a slab must only be used by the
+   thread which owns the debug context it belongs to. */
+void DHSlab_init(DHSlab *s, size_t item_size)
+{
+    assert(item_size >= sizeof(DHSlabFreeItem));
+    s->item_size = item_size;
+    s->chunks = NULL;
+    s->free_list = NULL;
+    s->bump = NULL;
+    s->bump_end = NULL;
+    s->n_chunks = 0;
+    s->n_used = 0;
+}
+
+void *DHSlab_alloc(DHSlab *s)
+{
+    void *item;
+    if (s->free_list != NULL) {
+        item = s->free_list;
+        s->free_list = s->free_list->next;
+    }
+    else {
+        if (s->bump == s->bump_end) {
+            DHSlabChunk *chunk = malloc(DHSLAB_HEADER_SIZE +
+                                        DHSLAB_CHUNK_ITEMS * s->item_size);
+            if (chunk == NULL)
+                return NULL;
+            chunk->next = s->chunks;
+            s->chunks = chunk;
+            s->n_chunks++;
+            s->bump = (char *)chunk + DHSLAB_HEADER_SIZE;
+            s->bump_end = s->bump + DHSLAB_CHUNK_ITEMS * s->item_size;
+        }
+        item = s->bump;
+        s->bump += s->item_size;
+    }
+    s->n_used++;
+    return item;
+}
+
+void DHSlab_free(DHSlab *s, void *item)
+{
+    assert(s->n_used > 0);
+    DHSlabFreeItem *f = (DHSlabFreeItem *)item;
+    f->next = s->free_list;
+    s->free_list = f;
+    s->n_used--;
+}
+
+/* Release all the chunks at once. All the items allocated from this slab
+   become invalid, even if they were not freed. */
+void DHSlab_clear(DHSlab *s)
+{
+    DHSlabChunk *chunk = s->chunks;
+    while (chunk != NULL) {
+        DHSlabChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    DHSlab_init(s, s->item_size);
+}
+
+HPy_ssize_t DHSlab_capacity(DHSlab *s)
+{
+    return s->n_chunks * DHSLAB_CHUNK_ITEMS;
+}
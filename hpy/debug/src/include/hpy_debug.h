@@ -54,4 +54,10 @@ extern "C"
 HPy_EXPORTED_SYMBOL
 void HPyInitGlobalContext__debug(HPyContext *ctx);
 
+#ifdef ___cplusplus
+extern "C"
+#endif
+HPy_EXPORTED_SYMBOL
+void HPyInitDirectCalls__debug(const _HPyFunc_DirectCallTable *table);
+
 #endif /* HPY_DEBUG_H */
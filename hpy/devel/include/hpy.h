@@ -14,7 +14,7 @@ extern "C" {
  * versions in one process).
  */
 #define HPY_ABI_VERSION 0
-#define HPY_ABI_VERSION_MINOR 0
+#define HPY_ABI_VERSION_MINOR 1
 #define HPY_ABI_TAG "hpy0"
 
 
@@ -190,6 +190,7 @@ typedef struct { intptr_t _i; } HPyField;
 typedef struct { intptr_t _i; } HPyGlobal;
 typedef struct { intptr_t _lst; } HPyListBuilder;
 typedef struct { intptr_t _tup; } HPyTupleBuilder;
+typedef struct { intptr_t _dict; } HPyDictBuilder;
 typedef struct { intptr_t _i; } HPyTracker;
 typedef struct { intptr_t _i; } HPyThreadState;
 
@@ -213,6 +214,31 @@ static inline void* HPy_AsVoidP(HPy h) { return (void*)h._i; }
 
 typedef struct _HPyContext_s HPyContext;
 
+/**
+ * A method call site for :c:func:`HPy_CallMethodCached`. It is meant to be
+ * declared ``static`` at the call site and only ``name`` and (optionally)
+ * ``kwnames`` must be initialized by the user, e.g.::
+ *
+ *     static const char *kwnames[] = { "sep", NULL };
+ *     static HPyCallSite join_site = { "join", kwnames };
+ *
+ * ``kwnames`` is a NULL-terminated array with the names of the keyword
+ * arguments which are passed at every call, or ``NULL``. The remaining fields
+ * are private: they hold the name objects and cache the method found for the
+ * last type of receiver; they are initialized on first use and never freed.
+ */
+typedef struct {
+    const char *name;
+    const char **kwnames;
+
+    /* private */
+    void *_name;
+    void *_kwnames;
+    size_t _nkw;
+    unsigned int _version_tag;
+    void *_method;
+} HPyCallSite;
+
 /** An enumeration of the different kinds of source code strings. */
 typedef enum {
     /** Parse isolated expressions (e.g. ``a + b``). */
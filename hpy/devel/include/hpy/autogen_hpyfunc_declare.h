@@ -14,6 +14,7 @@
 #define _HPyFunc_DECLARE_HPyFunc_O(SYM) static HPy SYM(HPyContext *ctx, HPy self, HPy arg)
 #define _HPyFunc_DECLARE_HPyFunc_VARARGS(SYM) static HPy SYM(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
 #define _HPyFunc_DECLARE_HPyFunc_KEYWORDS(SYM) static HPy SYM(HPyContext *ctx, HPy self, const HPy *args, size_t nargs, HPy kwnames)
+#define _HPyFunc_DECLARE_HPyFunc_KWTABLE(SYM) static HPy SYM(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
 #define _HPyFunc_DECLARE_HPyFunc_UNARYFUNC(SYM) static HPy SYM(HPyContext *ctx, HPy)
 #define _HPyFunc_DECLARE_HPyFunc_BINARYFUNC(SYM) static HPy SYM(HPyContext *ctx, HPy, HPy)
 #define _HPyFunc_DECLARE_HPyFunc_TERNARYFUNC(SYM) static HPy SYM(HPyContext *ctx, HPy, HPy, HPy)
@@ -47,11 +48,14 @@
 #define _HPyFunc_DECLARE_HPyFunc_DESTRUCTOR(SYM) static void SYM(HPyContext *ctx, HPy)
 #define _HPyFunc_DECLARE_HPyFunc_DESTROYFUNC(SYM) static void SYM(void *)
 #define _HPyFunc_DECLARE_HPyFunc_MOD_CREATE(SYM) static HPy SYM(HPyContext *ctx, HPy)
+#define _HPyFunc_DECLARE_HPyFunc_ITERNEXTBATCHFUNC(SYM) static HPy_ssize_t SYM(HPyContext *ctx, HPy self, HPy *items, HPy_ssize_t n)
+#define _HPyFunc_DECLARE_HPyFunc_SENDFUNC(SYM) static HPySendResult SYM(HPyContext *ctx, HPy self, HPy value, HPy *result)
 
 typedef HPy (*HPyFunc_noargs)(HPyContext *ctx, HPy self);
 typedef HPy (*HPyFunc_o)(HPyContext *ctx, HPy self, HPy arg);
 typedef HPy (*HPyFunc_varargs)(HPyContext *ctx, HPy self, const HPy *args, size_t nargs);
 typedef HPy (*HPyFunc_keywords)(HPyContext *ctx, HPy self, const HPy *args, size_t nargs, HPy kwnames);
+typedef HPy (*HPyFunc_kwtable)(HPyContext *ctx, HPy self, const HPy *args, size_t nargs);
 typedef HPy (*HPyFunc_unaryfunc)(HPyContext *ctx, HPy);
 typedef HPy (*HPyFunc_binaryfunc)(HPyContext *ctx, HPy, HPy);
 typedef HPy (*HPyFunc_ternaryfunc)(HPyContext *ctx, HPy, HPy, HPy);
@@ -85,3 +89,5 @@ typedef int (*HPyFunc_traverseproc)(void *object, HPyFunc_visitproc visit, void
 typedef void (*HPyFunc_destructor)(HPyContext *ctx, HPy);
 typedef void (*HPyFunc_destroyfunc)(void *);
 typedef HPy (*HPyFunc_mod_create)(HPyContext *ctx, HPy);
+typedef HPy_ssize_t (*HPyFunc_iternextbatchfunc)(HPyContext *ctx, HPy self, HPy *items, HPy_ssize_t n);
+typedef HPySendResult (*HPyFunc_sendfunc)(HPyContext *ctx, HPy self, HPy value, HPy *result);
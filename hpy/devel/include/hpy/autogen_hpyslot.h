@@ -61,6 +61,8 @@ typedef enum {
     HPy_tp_descr_get = 54,
     HPy_tp_hash = 59,
     HPy_tp_init = 60,
+    HPy_tp_iter = 62,
+    HPy_tp_iternext = 63,
     HPy_tp_new = 65,
     HPy_tp_repr = 66,
     HPy_tp_richcompare = 67,
@@ -68,8 +70,13 @@ typedef enum {
     HPy_tp_traverse = 71,
     HPy_nb_matrix_multiply = 75,
     HPy_nb_inplace_matrix_multiply = 76,
+    HPy_am_await = 77,
+    HPy_am_aiter = 78,
+    HPy_am_anext = 79,
     HPy_tp_finalize = 80,
+    HPy_am_send = 81,
     HPy_tp_destroy = 1000,
+    HPy_tp_iternext_batch = 1001,
     HPy_mod_create = 2000,
     HPy_mod_exec = 2001,
 } HPySlot_Slot;
@@ -124,6 +131,8 @@ typedef enum {
 #define _HPySlot_SIG__HPy_tp_descr_get HPyFunc_TERNARYFUNC
 #define _HPySlot_SIG__HPy_tp_hash HPyFunc_HASHFUNC
 #define _HPySlot_SIG__HPy_tp_init HPyFunc_INITPROC
+#define _HPySlot_SIG__HPy_tp_iter HPyFunc_GETITERFUNC
+#define _HPySlot_SIG__HPy_tp_iternext HPyFunc_ITERNEXTFUNC
 #define _HPySlot_SIG__HPy_tp_new HPyFunc_NEWFUNC
 #define _HPySlot_SIG__HPy_tp_repr HPyFunc_REPRFUNC
 #define _HPySlot_SIG__HPy_tp_richcompare HPyFunc_RICHCMPFUNC
@@ -131,7 +140,12 @@ typedef enum {
 #define _HPySlot_SIG__HPy_tp_traverse HPyFunc_TRAVERSEPROC
 #define _HPySlot_SIG__HPy_nb_matrix_multiply HPyFunc_BINARYFUNC
 #define _HPySlot_SIG__HPy_nb_inplace_matrix_multiply HPyFunc_BINARYFUNC
+#define _HPySlot_SIG__HPy_am_await HPyFunc_UNARYFUNC
+#define _HPySlot_SIG__HPy_am_aiter HPyFunc_UNARYFUNC
+#define _HPySlot_SIG__HPy_am_anext HPyFunc_UNARYFUNC
 #define _HPySlot_SIG__HPy_tp_finalize HPyFunc_DESTRUCTOR
+#define _HPySlot_SIG__HPy_am_send HPyFunc_SENDFUNC
 #define _HPySlot_SIG__HPy_tp_destroy HPyFunc_DESTROYFUNC
+#define _HPySlot_SIG__HPy_tp_iternext_batch HPyFunc_ITERNEXTBATCHFUNC
 #define _HPySlot_SIG__HPy_mod_create HPyFunc_MOD_CREATE
 #define _HPySlot_SIG__HPy_mod_exec HPyFunc_INQUIRY
@@ -45,5 +45,7 @@ typedef int (*cpy_setter)(cpy_PyObject *, cpy_PyObject *, void *);
 typedef void (*cpy_PyCapsule_Destructor)(cpy_PyObject *);
 typedef cpy_PyObject *(*cpy_vectorcallfunc)(cpy_PyObject *callable, cpy_PyObject *const *args,
                                     size_t nargsf, cpy_PyObject *kwnames);
+typedef HPy_ssize_t (*cpy_iternextbatchfunc)(cpy_PyObject *self, cpy_PyObject **items,
+                                             HPy_ssize_t n);
 
 #endif /* HPY_UNIVERSAL_CPY_TYPES_H */
@@ -24,6 +24,27 @@ typedef HPy (*_HPyCFunction_KEYWORDS)(HPyContext*, HPy, const HPy *, size_t, HPy
                           PyVectorcall_NARGS(nargsf), _py2h(kwnames)));   \
     }
 
+_HPy_HIDDEN int
+_HPyKwTable_PlaceArgs(HPyKwTable *kwtable, cpy_PyObject *const *args,
+                      size_t nargsf, cpy_PyObject *kwnames,
+                      cpy_PyObject **params);
+
+typedef HPy (*_HPyCFunction_KWTABLE)(HPyContext*, HPy, const HPy *, size_t);
+#define _HPyFunc_KWTABLE_TRAMPOLINE(SYM, IMPL, KWTABLE, NPARAMS)          \
+    static PyObject *                                                     \
+    SYM(PyObject *self, PyObject *const *args, size_t nargsf,             \
+            PyObject *kwnames)                                            \
+    {                                                                     \
+        _HPyCFunction_KWTABLE func = (_HPyCFunction_KWTABLE)IMPL;         \
+        /* one more item, so that the array is never empty */             \
+        PyObject *params[(NPARAMS) + 1];                                  \
+        if (_HPyKwTable_PlaceArgs(KWTABLE, args, nargsf, kwnames,         \
+                                  params) < 0)                            \
+            return NULL;                                                  \
+        return _h2py(func(_HPyGetContext(), _py2h(self),                  \
+                          _arr_py2h(params), (NPARAMS)));                 \
+    }
+
 typedef int (*_HPyCFunction_INITPROC)(HPyContext*, HPy, const HPy *, HPy_ssize_t, HPy);
 #define _HPyFunc_TRAMPOLINE_HPyFunc_INITPROC(SYM, IMPL)                 \
     static int                                                          \
@@ -89,6 +110,23 @@ typedef int (*_HPyCFunction_RELEASEBUFFERPROC)(HPyContext *, HPy, HPy_buffer *);
         return; \
     }
 
+/* With the cpython ABI, HPy and PyObject* are ABI-compatible, so the items
+   can be stored directly in the array of the caller */
+typedef HPy_ssize_t (*_HPyCFunction_ITERNEXTBATCHFUNC)(HPyContext *, HPy, HPy *, HPy_ssize_t);
+#define _HPyFunc_TRAMPOLINE_HPyFunc_ITERNEXTBATCHFUNC(SYM, IMPL) \
+    static HPy_ssize_t SYM(PyObject *self, PyObject **items, HPy_ssize_t n) \
+    { \
+        _HPyCFunction_ITERNEXTBATCHFUNC func = (_HPyCFunction_ITERNEXTBATCHFUNC)IMPL; \
+        return func(_HPyGetContext(), _py2h(self), (HPy *)items, n); \
+    }
+
+typedef HPySendResult (*_HPyCFunction_SENDFUNC)(HPyContext *, HPy, HPy, HPy *);
+#define _HPyFunc_TRAMPOLINE_HPyFunc_SENDFUNC(SYM, IMPL) \
+    static HPySendResult SYM(PyObject *self, PyObject *value, PyObject **presult) \
+    { \
+        _HPyCFunction_SENDFUNC func = (_HPyCFunction_SENDFUNC)IMPL; \
+        return func(_HPyGetContext(), _py2h(self), _py2h(value), (HPy *)presult); \
+    }
 
 #define _HPyFunc_TRAMPOLINE_HPyFunc_TRAVERSEPROC(SYM, IMPL)             \
     static int SYM(cpy_PyObject *self, cpy_visitproc visit, void *arg)  \
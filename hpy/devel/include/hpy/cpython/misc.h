@@ -162,6 +162,21 @@ HPyAPI_FUNC void HPy_Close(HPyContext *ctx, HPy handle)
     Py_XDECREF(_h2py(handle));
 }
 
+HPyAPI_FUNC void HPy_CloseMany(HPyContext *ctx, const HPy *hs, HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++)
+        Py_XDECREF(_h2py(hs[i]));
+}
+
+HPyAPI_FUNC void HPy_DupMany(HPyContext *ctx, const HPy *hs, HPy *out,
+                             HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        Py_XINCREF(_h2py(hs[i]));
+        out[i] = hs[i];
+    }
+}
+
 HPyAPI_FUNC void HPyField_Store(HPyContext *ctx, HPy target_obj,
                                 HPyField *target_field, HPy h)
 {
@@ -179,6 +194,22 @@ HPyAPI_FUNC HPy HPyField_Load(HPyContext *ctx, HPy source_obj, HPyField source_f
     return _py2h(obj);
 }
 
+HPyAPI_FUNC void HPyField_StoreMany(HPyContext *ctx, HPy target_obj,
+                                    HPyField **target_fields, const HPy *hs,
+                                    HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++)
+        HPyField_Store(ctx, target_obj, target_fields[i], hs[i]);
+}
+
+HPyAPI_FUNC void HPyField_LoadMany(HPyContext *ctx, HPy source_obj,
+                                   HPyField **source_fields, HPy *out,
+                                   HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++)
+        out[i] = HPyField_Load(ctx, source_obj, *source_fields[i]);
+}
+
 HPyAPI_FUNC void HPyGlobal_Store(HPyContext *ctx, HPyGlobal *global, HPy h)
 {
     PyObject *obj = _h2py(h);
@@ -306,6 +337,42 @@ HPyAPI_FUNC HPy HPy_CallMethod(HPyContext *ctx, HPy name, const HPy *args, size_
 #endif
 }
 
+HPyAPI_FUNC HPy HPy_CallMethodCached(HPyContext *ctx, HPyCallSite *site, const HPy *args, size_t nargs)
+{
+    return ctx_CallMethodCached(ctx, site, args, nargs);
+}
+
+HPyAPI_FUNC HPy_ssize_t HPyIter_NextBatch(HPyContext *ctx, HPy obj, HPy *items, HPy_ssize_t n)
+{
+    return ctx_Iter_NextBatch(ctx, obj, items, n);
+}
+
+HPyAPI_FUNC int HPy_GetBuffer(HPyContext *ctx, HPy obj, HPy_buffer *view, int flags)
+{
+    return ctx_GetBuffer(ctx, obj, view, flags);
+}
+
+HPyAPI_FUNC void HPyBuffer_Release(HPyContext *ctx, HPy_buffer *view)
+{
+    ctx_Buffer_Release(ctx, view);
+}
+
+HPyAPI_FUNC int HPyBuffer_IsContiguous(HPyContext *ctx, const HPy_buffer *view, char order)
+{
+    return ctx_Buffer_IsContiguous(ctx, view, order);
+}
+
+HPyAPI_FUNC int HPyBuffer_ToContiguous(HPyContext *ctx, void *buf, const HPy_buffer *view,
+                                       HPy_ssize_t len, char order)
+{
+    return ctx_Buffer_ToContiguous(ctx, buf, view, len, order);
+}
+
+HPyAPI_FUNC int HPyDict_Next(HPyContext *ctx, HPy h, HPy_ssize_t *pos, HPy *key, HPy *value)
+{
+    return ctx_Dict_Next(ctx, h, pos, key, value);
+}
+
 HPyAPI_FUNC void _HPy_Dump(HPyContext *ctx, HPy h)
 {
     ctx_Dump(ctx, h);
@@ -370,6 +437,33 @@ HPyAPI_FUNC void HPyTupleBuilder_Cancel(HPyContext *ctx, HPyTupleBuilder builder
     ctx_TupleBuilder_Cancel(ctx, builder);
 }
 
+HPyAPI_FUNC HPyDictBuilder HPyDictBuilder_New(HPyContext *ctx, HPy_ssize_t size)
+{
+    return ctx_DictBuilder_New(ctx, size);
+}
+
+HPyAPI_FUNC int HPyDictBuilder_Set(HPyContext *ctx, HPyDictBuilder builder,
+                                   HPy h_key, HPy h_value)
+{
+    return ctx_DictBuilder_Set(ctx, builder, h_key, h_value);
+}
+
+HPyAPI_FUNC int HPyDictBuilder_Set_s(HPyContext *ctx, HPyDictBuilder builder,
+                                     const char *utf8_key, HPy h_value)
+{
+    return ctx_DictBuilder_Set_s(ctx, builder, utf8_key, h_value);
+}
+
+HPyAPI_FUNC HPy HPyDictBuilder_Build(HPyContext *ctx, HPyDictBuilder builder)
+{
+    return ctx_DictBuilder_Build(ctx, builder);
+}
+
+HPyAPI_FUNC void HPyDictBuilder_Cancel(HPyContext *ctx, HPyDictBuilder builder)
+{
+    ctx_DictBuilder_Cancel(ctx, builder);
+}
+
 HPyAPI_FUNC HPy HPyTuple_FromArray(HPyContext *ctx, HPy items[], HPy_ssize_t n)
 {
     return ctx_Tuple_FromArray(ctx, items, n);
@@ -60,6 +60,12 @@ typedef struct {
     /** Docstring of the method (UTF-8 encoded; may be ``NULL``) */
     const char *doc;
 
+    /**
+     * Parameter list of a method with signature ``HPyFunc_KWTABLE`` (see
+     * :c:macro:`HPyDef_METH_KW`); ``NULL`` for the other signatures.
+     */
+    HPyKwTable *kwtable;
+
 } HPyMeth;
 
 /**
@@ -301,6 +307,63 @@ typedef struct {
 #define HPyDef_METH(SYM, NAME, SIG, ...) \
     HPyDef_METH_IMPL(SYM, NAME, SYM##_impl, SIG, __VA_ARGS__)
 
+#define HPyDef_METH_KW_IMPL(SYM, NAME, IMPL, KWLIST, ...)                  \
+    HPyFunc_DECLARE(IMPL, HPyFunc_KWTABLE);                                 \
+    static HPyKwTable SYM##_kwtable = {                                     \
+        .kwlist = KWLIST,                                                   \
+        .nparams = sizeof(KWLIST) / sizeof(KWLIST[0]) - 1,                  \
+        .name = NAME                                                        \
+    };                                                                      \
+    _HPyFunc_KWTABLE_TRAMPOLINE(SYM##_trampoline, IMPL, &SYM##_kwtable,     \
+                                sizeof(KWLIST) / sizeof(KWLIST[0]) - 1)     \
+    HPyDef SYM = {                                                          \
+        .kind = HPyDef_Kind_Meth,                                           \
+        .meth = {                                                           \
+            .name = NAME,                                                   \
+            .impl = (HPyCFunction)IMPL,                                     \
+            .cpy_trampoline = (cpy_PyCFunction)SYM##_trampoline,            \
+            .signature = HPyFunc_KWTABLE,                                   \
+            .kwtable = &SYM##_kwtable,                                      \
+            __VA_ARGS__                                                     \
+        }                                                                   \
+    };
+
+/**
+ * Like :c:macro:`HPyDef_METH`, but for a method which accepts keyword
+ * arguments and whose parameter list is declared at definition time.
+ *
+ * The implementing C function ``SYM_impl`` has the signature::
+ *
+ *     HPy SYM_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+ *
+ * where ``args`` always contains one item per parameter, in the order of
+ * ``KWLIST``: the runtime places the positional and keyword arguments of the
+ * call in their slots, so the function does not need to parse its keyword
+ * arguments. The slots of the arguments which were not given are
+ * ``HPy_NULL``; it is up to the function to reject missing required
+ * arguments. Unknown keywords, too many positional arguments and arguments
+ * which are given twice raise ``TypeError`` before the function is called.
+ *
+ * Example::
+ *
+ *     static const char *add_kwlist[] = { "a", "b", NULL };
+ *     HPyDef_METH_KW(add, "add", add_kwlist)
+ *     static HPy add_impl(HPyContext *ctx, HPy self, const HPy *args,
+ *                         size_t nargs)
+ *     {
+ *         // args[0] is 'a' and args[1] is 'b'
+ *     }
+ *
+ * :param SYM: A C symbol name of the resulting global variable that will
+ *             contain the generated HPy definition. The variable is defined
+ *             as ``static``.
+ * :param NAME: The Python attribute name (UTF-8 encoded).
+ * :param KWLIST: A ``NULL``-terminated array (not a pointer) of parameter
+ *                names (UTF-8 encoded).
+ */
+#define HPyDef_METH_KW(SYM, NAME, KWLIST, ...) \
+    HPyDef_METH_KW_IMPL(SYM, NAME, SYM##_impl, KWLIST, __VA_ARGS__)
+
 /**
  * A convenience macro and recommended way to create a definition for an HPy
  * member.
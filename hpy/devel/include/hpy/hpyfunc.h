@@ -45,6 +45,11 @@ typedef enum {
 
     HPyFunc_MOD_CREATE,
 
+    HPyFunc_KWTABLE,  // METH_FASTCALL | METH_KEYWORDS, see HPyDef_METH_KW
+
+    HPyFunc_ITERNEXTBATCHFUNC,
+    HPyFunc_SENDFUNC,
+
 } HPyFunc_Signature;
 
 /* The typedefs corresponding to the various HPyFunc_Signature members
@@ -79,6 +84,16 @@ typedef enum {
     enum { SYM##_sig = SIG };              \
     _HPyFunc_TRAMPOLINE_##SIG(SYM, IMPL)
 
+/**
+ * The return value of the ``HPy_am_send`` slot. The values are the same as
+ * the ones of CPython's ``PySendResult``.
+ */
+typedef enum {
+    HPySend_RETURN = 0,
+    HPySend_ERROR = -1,
+    HPySend_NEXT = 1,
+} HPySendResult;
+
 typedef struct {
     void *buf;
     HPy obj;        /* owned reference */
@@ -93,8 +108,50 @@ typedef struct {
     void *internal;
 } HPy_buffer;
 
+/* Flags for HPy_GetBuffer and HPy_bf_getbuffer: same values as CPython's
+   PyBUF_* flags */
+#define HPyBUF_SIMPLE 0
+#define HPyBUF_WRITABLE 0x0001
+#define HPyBUF_FORMAT 0x0004
+#define HPyBUF_ND 0x0008
+#define HPyBUF_STRIDES (0x0010 | HPyBUF_ND)
+#define HPyBUF_C_CONTIGUOUS (0x0020 | HPyBUF_STRIDES)
+#define HPyBUF_F_CONTIGUOUS (0x0040 | HPyBUF_STRIDES)
+#define HPyBUF_ANY_CONTIGUOUS (0x0080 | HPyBUF_STRIDES)
+#define HPyBUF_INDIRECT (0x0100 | HPyBUF_STRIDES)
+
+#define HPyBUF_CONTIG (HPyBUF_ND | HPyBUF_WRITABLE)
+#define HPyBUF_CONTIG_RO (HPyBUF_ND)
+#define HPyBUF_STRIDED (HPyBUF_STRIDES | HPyBUF_WRITABLE)
+#define HPyBUF_STRIDED_RO (HPyBUF_STRIDES)
+#define HPyBUF_RECORDS (HPyBUF_STRIDES | HPyBUF_WRITABLE | HPyBUF_FORMAT)
+#define HPyBUF_RECORDS_RO (HPyBUF_STRIDES | HPyBUF_FORMAT)
+#define HPyBUF_FULL (HPyBUF_INDIRECT | HPyBUF_WRITABLE | HPyBUF_FORMAT)
+#define HPyBUF_FULL_RO (HPyBUF_INDIRECT | HPyBUF_FORMAT)
+
 typedef int (*HPyFunc_visitproc)(HPyField *, void *);
 
+/**
+ * The parameter list of a method defined with :c:macro:`HPyDef_METH_KW`.
+ *
+ * The macro fills the public fields. When the method is added to a type or
+ * module, the runtime interns the parameter names, so that the keyword
+ * arguments of a call can be matched to their parameters by identity.
+ */
+typedef struct {
+    /** ``NULL``-terminated array of parameter names (UTF-8 encoded) */
+    const char *const *kwlist;
+
+    /** Number of parameters, i.e. the length of ``kwlist`` */
+    HPy_ssize_t nparams;
+
+    /** Name of the method, used in error messages */
+    const char *name;
+
+    /* private */
+    cpy_PyObject **_kwnames;
+} HPyKwTable;
+
 /* COPIED AND ADAPTED FROM CPython.
  * Utility macro to help write tp_traverse functions
  * To use this macro, the tp_traverse function must name its arguments
@@ -7,10 +7,25 @@
    methods/member/slots/... must be defined in the same file, and (2) the
    embedder *MUST* declare the module to be "embeddable" by using macro
    'HPY_MOD_EMBEDDABLE(modname)'. */
+
+/* A table of per-signature entry points, indexed by HPyFunc_Signature. Each
+   entry does the same as '_HPy_CallRealFunctionFromTrampoline' for exactly one
+   signature, without going through the generic switch. The HPy
+   implementation may pass such a table to the module when loading it (see
+   'HPyInitDirectCalls_<extname>' below); if it doesn't, the trampolines use
+   the generic entry point. */
+typedef void (*_HPyFunc_DirectCall)(HPyContext *ctx, HPyCFunction func,
+                                    void *args);
+typedef struct {
+    size_t size;
+    const _HPyFunc_DirectCall *calls;
+} _HPyFunc_DirectCallTable;
+
 #ifdef HPY_EMBEDDED_MODULES
 #define _HPy_CTX_MODIFIER static
 #define HPY_MOD_EMBEDDABLE(modname) \
-    _HPy_CTX_MODIFIER HPyContext *_ctx_for_trampolines;
+    _HPy_CTX_MODIFIER HPyContext *_ctx_for_trampolines; \
+    _HPy_CTX_MODIFIER const _HPyFunc_DirectCallTable *_direct_calls_for_trampolines;
 #else
 #define _HPy_CTX_MODIFIER _HPy_HIDDEN
 /**
@@ -21,8 +36,9 @@
  * are in the same file.
  */
 #define HPY_MOD_EMBEDDABLE(modname)
-// this is defined by HPy_MODINIT
+// these are defined by HPy_MODINIT
 extern HPyContext *_ctx_for_trampolines;
+extern const _HPyFunc_DirectCallTable *_direct_calls_for_trampolines;
 #endif
 
 
@@ -103,7 +119,7 @@ typedef struct {
 
 /**
  * Convenience macro for generating the module initialization code. This will
- * generate three functions that are used by to verify an initialize the module
+ * generate the functions that are used by to verify an initialize the module
  * when loading:
  *
  * ``get_required_hpy_major_version_<modname>``
@@ -112,6 +128,14 @@ typedef struct {
  * ``get_required_hpy_minor_version_<modname>``
  *   The HPy minor version this module was built with.
  *
+ * ``HPyInitGlobalContext_<modname>``
+ *   Sets the context used by the CPython trampolines of the module.
+ *
+ * ``HPyInitDirectCalls_<modname>``
+ *   Optional for the interpreter: sets the table of per-signature entry points
+ *   used by the trampolines. If it is never called, all calls go through
+ *   ``_HPy_CallRealFunctionFromTrampoline``.
+ *
  * ``HPyModuleDef* HPyInit_<extname>``
  *   The init function that will be called by the interpreter. This function
  *   does not have an access to HPyContext and thus cannot call any HPy APIs.
@@ -150,6 +174,17 @@ typedef struct {
     {                                                          \
         _ctx_for_trampolines = ctx;                            \
     }                                                          \
+    _HPy_CTX_MODIFIER const _HPyFunc_DirectCallTable           \
+        *_direct_calls_for_trampolines;                        \
+    HPy_EXPORTED_FUNC void                                     \
+    HPyInitDirectCalls_##ext_name(                             \
+        const _HPyFunc_DirectCallTable *table);                \
+    void                                                       \
+    HPyInitDirectCalls_##ext_name(                             \
+        const _HPyFunc_DirectCallTable *table)                 \
+    {                                                          \
+        _direct_calls_for_trampolines = table;                 \
+    }                                                          \
     HPy_EXPORTED_FUNC HPyModuleDef*                            \
     HPyInit_##ext_name()                                       \
     {                                                          \
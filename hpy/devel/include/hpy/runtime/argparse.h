@@ -6,15 +6,63 @@ extern "C" {
 
 #include "hpy.h"
 
+/**
+ * A precompiled keyword argument parser, to be used with
+ * ``HPyArg_ParseKeywordsWithParser``. It is meant to be declared ``static``
+ * at the call site and only ``fmt`` and ``keywords`` must be initialized by
+ * the user, e.g.::
+ *
+ *     static const char *kwlist[] = { "a", "b", NULL };
+ *     static HPyArg_KeywordsParser parser = { "OO", kwlist };
+ *
+ * The remaining fields are private and are lazily initialized on first use.
+ */
+typedef struct {
+    const char *fmt;
+    const char **keywords;
+
+    /* private */
+    HPy_ssize_t _nkw;
+    HPyGlobal *_kwnames;
+} HPyArg_KeywordsParser;
+
+/**
+ * A precompiled format string for ``HPyArg_ParseWithPlan``. It is meant to be
+ * declared ``static`` at the call site and only ``fmt`` must be initialized
+ * by the user, e.g.::
+ *
+ *     static HPyArg_ParsePlan plan = { "ll|O" };
+ *
+ * The remaining fields are private and are lazily initialized on first use.
+ */
+typedef struct {
+    const char *fmt;
+
+    /* private */
+    char *_units;
+    size_t _n_units;
+    size_t _n_required;
+    const char *_err_fmt;
+} HPyArg_ParsePlan;
+
 HPyAPI_HELPER int
 HPyArg_Parse(HPyContext *ctx, HPyTracker *ht, const HPy *args,
              size_t nargs, const char *fmt, ...);
 
+HPyAPI_HELPER int
+HPyArg_ParseWithPlan(HPyContext *ctx, HPyTracker *ht, const HPy *args,
+                     size_t nargs, HPyArg_ParsePlan *plan, ...);
+
 HPyAPI_HELPER int
 HPyArg_ParseKeywords(HPyContext *ctx, HPyTracker *ht, const HPy *args,
                      size_t nargs, HPy kwnames, const char *fmt,
                      const char *keywords[], ...);
 
+HPyAPI_HELPER int
+HPyArg_ParseKeywordsWithParser(HPyContext *ctx, HPyTracker *ht,
+                               const HPy *args, size_t nargs, HPy kwnames,
+                               HPyArg_KeywordsParser *parser, ...);
+
 HPyAPI_HELPER int
 HPyArg_ParseKeywordsDict(HPyContext *ctx, HPyTracker *ht, const HPy *args,
                          HPy_ssize_t nargs, HPy kw, const char *fmt,
@@ -3,7 +3,27 @@
 
 #include "hpy.h"
 
+/**
+ * A precompiled format string for ``HPy_BuildValueWithPlan``. It is meant to
+ * be declared ``static`` at the call site and only ``fmt`` must be initialized
+ * by the user, e.g.::
+ *
+ *     static HPy_BuildValuePlan plan = { "(ii)" };
+ *
+ * The remaining fields are private and are lazily initialized on first use.
+ */
+typedef struct {
+    const char *fmt;
+
+    /* private */
+    HPy_ssize_t _size;
+    struct _HPyBuildValueOp_s *_ops;
+} HPy_BuildValuePlan;
+
 HPyAPI_HELPER HPy
 HPy_BuildValue(HPyContext *ctx, const char *fmt, ...);
 
+HPyAPI_HELPER HPy
+HPy_BuildValueWithPlan(HPyContext *ctx, HPy_BuildValuePlan *plan, ...);
+
 #endif /* HPY_COMMON_RUNTIME_BUILDVALUE_H */
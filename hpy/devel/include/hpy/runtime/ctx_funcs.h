@@ -6,6 +6,16 @@
 
 #include "hpy.h"
 
+// ctx_buffer.c
+_HPy_HIDDEN int ctx_GetBuffer(HPyContext *ctx, HPy h_obj, HPy_buffer *view,
+                              int flags);
+_HPy_HIDDEN void ctx_Buffer_Release(HPyContext *ctx, HPy_buffer *view);
+_HPy_HIDDEN int ctx_Buffer_IsContiguous(HPyContext *ctx, const HPy_buffer *view,
+                                        char order);
+_HPy_HIDDEN int ctx_Buffer_ToContiguous(HPyContext *ctx, void *buf,
+                                        const HPy_buffer *view, HPy_ssize_t len,
+                                        char order);
+
 // ctx_bytes.c
 _HPy_HIDDEN HPy ctx_Bytes_FromStringAndSize(HPyContext *ctx, const char *v,
                                             HPy_ssize_t len);
@@ -14,6 +24,22 @@ _HPy_HIDDEN HPy ctx_Bytes_FromStringAndSize(HPyContext *ctx, const char *v,
 _HPy_HIDDEN HPy ctx_CallTupleDict(HPyContext *ctx, HPy callable, HPy args, HPy kw);
 _HPy_HIDDEN HPy ctx_Call(HPyContext *ctx, HPy callable, const HPy *args, size_t nargs, HPy kwnames);
 _HPy_HIDDEN HPy ctx_CallMethod(HPyContext *ctx, HPy name, const HPy *args, size_t nargs, HPy kwnames);
+_HPy_HIDDEN HPy ctx_CallMethodCached(HPyContext *ctx, HPyCallSite *site, const HPy *args, size_t nargs);
+
+// ctx_dict.c
+_HPy_HIDDEN int ctx_Dict_Next(HPyContext *ctx, HPy h, HPy_ssize_t *pos,
+                              HPy *h_key, HPy *h_value);
+
+// ctx_dictbuilder.c
+_HPy_HIDDEN HPyDictBuilder ctx_DictBuilder_New(HPyContext *ctx,
+                                               HPy_ssize_t size);
+_HPy_HIDDEN int ctx_DictBuilder_Set(HPyContext *ctx, HPyDictBuilder builder,
+                                    HPy h_key, HPy h_value);
+_HPy_HIDDEN int ctx_DictBuilder_Set_s(HPyContext *ctx, HPyDictBuilder builder,
+                                      const char *utf8_key, HPy h_value);
+_HPy_HIDDEN HPy ctx_DictBuilder_Build(HPyContext *ctx, HPyDictBuilder builder);
+_HPy_HIDDEN void ctx_DictBuilder_Cancel(HPyContext *ctx,
+                                        HPyDictBuilder builder);
 
 // ctx_err.c
 _HPy_HIDDEN int ctx_Err_Occurred(HPyContext *ctx);
@@ -100,6 +126,8 @@ _HPy_HIDDEN HPyType_BuiltinShape ctx_Type_GetBuiltinShape(HPyContext *ctx,
 _HPy_HIDDEN const char *ctx_Type_GetName(HPyContext *ctx, HPy type);
 _HPy_HIDDEN int ctx_SetCallFunction(HPyContext *ctx, HPy h,
                                     HPyCallFunction *func);
+_HPy_HIDDEN HPy_ssize_t ctx_Iter_NextBatch(HPyContext *ctx, HPy h_iter,
+                                           HPy *items, HPy_ssize_t n);
 
 
 // ctx_long.c
@@ -8,6 +8,10 @@
 _HPy_HIDDEN PyMethodDef *create_method_defs(HPyDef *hpydefs[],
                                             PyMethodDef *legacy_methods);
 
+_HPy_HIDDEN int _HPyKwTable_PlaceArgs(HPyKwTable *kwtable,
+                                      PyObject *const *args, size_t nargsf,
+                                      PyObject *kwnames, PyObject **params);
+
 _HPy_HIDDEN int call_traverseproc_from_trampoline(HPyFunc_traverseproc tp_traverse,
                                                   PyObject *self,
                                                   cpy_visitproc cpy_visit,
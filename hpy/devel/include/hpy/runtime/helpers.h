@@ -12,4 +12,37 @@ HPyAPI_HELPER int
 HPyHelpers_PackArgsAndKeywords(HPyContext *ctx, const HPy *args, size_t nargs,
                                HPy kwnames, HPy *out_args_tuple, HPy *out_kwd);
 
+HPyAPI_HELPER HPy
+HPyHelpers_ForwardCall(HPyContext *ctx, HPy callable, HPy first,
+                       const HPy *args, size_t nargs, HPy kwnames);
+
+/**
+ * A view on the keyword arguments of a call using HPy's calling convention,
+ * see ``HPyKwargsView_Init``. The keyword arguments are only converted to a
+ * dictionary if ``HPyKwargsView_AsDict`` is called. All fields are private.
+ */
+typedef struct {
+    const HPy *_values;
+    HPy _kwnames;
+    HPy_ssize_t _nkw;
+    HPy _dict;
+} HPyKwargsView;
+
+HPyAPI_HELPER int
+HPyKwargsView_Init(HPyContext *ctx, HPyKwargsView *view, const HPy *args,
+                   size_t nargs, HPy kwnames);
+
+HPyAPI_HELPER HPy_ssize_t
+HPyKwargsView_Size(HPyKwargsView *view);
+
+HPyAPI_HELPER int
+HPyKwargsView_Get_s(HPyContext *ctx, HPyKwargsView *view, const char *name,
+                    HPy *out);
+
+HPyAPI_HELPER int
+HPyKwargsView_AsDict(HPyContext *ctx, HPyKwargsView *view, HPy *out_kwd);
+
+HPyAPI_HELPER void
+HPyKwargsView_Close(HPyContext *ctx, HPyKwargsView *view);
+
 #endif /* HPY_COMMON_RUNTIME_HELPERS_H */
@@ -287,4 +287,22 @@ struct _HPyContext_s {
     HPy (*ctx_Iter_Next)(HPyContext *ctx, HPy obj);
     int (*ctx_Iter_Check)(HPyContext *ctx, HPy obj);
     HPy (*ctx_Slice_New)(HPyContext *ctx, HPy start, HPy stop, HPy step);
+    void (*ctx_CloseMany)(HPyContext *ctx, const HPy *hs, HPy_ssize_t n);
+    void (*ctx_DupMany)(HPyContext *ctx, const HPy *hs, HPy *out, HPy_ssize_t n);
+    HPy (*ctx_StructSequence_New)(HPyContext *ctx, HPy type, HPy_ssize_t nargs, const HPy *args);
+    void (*ctx_Field_StoreMany)(HPyContext *ctx, HPy target_object, HPyField **target_fields, const HPy *hs, HPy_ssize_t n);
+    void (*ctx_Field_LoadMany)(HPyContext *ctx, HPy source_object, HPyField **source_fields, HPy *out, HPy_ssize_t n);
+    void (*ctx_Field_WriteBarrier)(HPyContext *ctx, HPy target_object);
+    HPy (*ctx_CallMethodCached)(HPyContext *ctx, HPyCallSite *site, const HPy *args, size_t nargs);
+    HPy_ssize_t (*ctx_Iter_NextBatch)(HPyContext *ctx, HPy obj, HPy *items, HPy_ssize_t n);
+    int (*ctx_GetBuffer)(HPyContext *ctx, HPy obj, HPy_buffer *view, int flags);
+    void (*ctx_Buffer_Release)(HPyContext *ctx, HPy_buffer *view);
+    int (*ctx_Buffer_IsContiguous)(HPyContext *ctx, const HPy_buffer *view, char order);
+    int (*ctx_Buffer_ToContiguous)(HPyContext *ctx, void *buf, const HPy_buffer *view, HPy_ssize_t len, char order);
+    int (*ctx_Dict_Next)(HPyContext *ctx, HPy h, HPy_ssize_t *pos, HPy *key, HPy *value);
+    HPyDictBuilder (*ctx_DictBuilder_New)(HPyContext *ctx, HPy_ssize_t size);
+    int (*ctx_DictBuilder_Set)(HPyContext *ctx, HPyDictBuilder builder, HPy h_key, HPy h_value);
+    int (*ctx_DictBuilder_Set_s)(HPyContext *ctx, HPyDictBuilder builder, const char *utf8_key, HPy h_value);
+    HPy (*ctx_DictBuilder_Build)(HPyContext *ctx, HPyDictBuilder builder);
+    void (*ctx_DictBuilder_Cancel)(HPyContext *ctx, HPyDictBuilder builder);
 };
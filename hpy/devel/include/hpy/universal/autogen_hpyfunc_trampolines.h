@@ -19,8 +19,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *self) \
     { \
         _HPyFunc_args_NOARGS a = { self }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_NOARGS, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_NOARGS, IMPL, &a); \
         return a.result; \
     }
 
@@ -34,8 +33,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *self, cpy_PyObject *arg) \
     { \
         _HPyFunc_args_O a = { self, arg }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_O, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_O, IMPL, &a); \
         return a.result; \
     }
 
@@ -48,8 +46,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_UNARYFUNC a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_UNARYFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_UNARYFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -63,8 +60,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, cpy_PyObject *arg1) \
     { \
         _HPyFunc_args_BINARYFUNC a = { arg0, arg1 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_BINARYFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_BINARYFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -79,8 +75,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, cpy_PyObject *arg1, cpy_PyObject *arg2) \
     { \
         _HPyFunc_args_TERNARYFUNC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_TERNARYFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_TERNARYFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -93,8 +88,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_INQUIRY a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_INQUIRY, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_INQUIRY, IMPL, &a); \
         return a.result; \
     }
 
@@ -107,8 +101,7 @@ typedef struct {
     static HPy_ssize_t SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_LENFUNC a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_LENFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_LENFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -122,8 +115,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, HPy_ssize_t arg1) \
     { \
         _HPyFunc_args_SSIZEARGFUNC a = { arg0, arg1 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_SSIZEARGFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SSIZEARGFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -138,8 +130,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, HPy_ssize_t arg1, HPy_ssize_t arg2) \
     { \
         _HPyFunc_args_SSIZESSIZEARGFUNC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_SSIZESSIZEARGFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SSIZESSIZEARGFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -154,8 +145,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, HPy_ssize_t arg1, cpy_PyObject *arg2) \
     { \
         _HPyFunc_args_SSIZEOBJARGPROC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_SSIZEOBJARGPROC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SSIZEOBJARGPROC, IMPL, &a); \
         return a.result; \
     }
 
@@ -171,8 +161,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, HPy_ssize_t arg1, HPy_ssize_t arg2, cpy_PyObject *arg3) \
     { \
         _HPyFunc_args_SSIZESSIZEOBJARGPROC a = { arg0, arg1, arg2, arg3 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_SSIZESSIZEOBJARGPROC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SSIZESSIZEOBJARGPROC, IMPL, &a); \
         return a.result; \
     }
 
@@ -187,8 +176,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, cpy_PyObject *arg1, cpy_PyObject *arg2) \
     { \
         _HPyFunc_args_OBJOBJARGPROC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_OBJOBJARGPROC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_OBJOBJARGPROC, IMPL, &a); \
         return a.result; \
     }
 
@@ -200,8 +188,7 @@ typedef struct {
     static void SYM(void *arg0) \
     { \
         _HPyFunc_args_FREEFUNC a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_FREEFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_FREEFUNC, IMPL, &a); \
         return; \
     }
 
@@ -215,8 +202,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, char *arg1) \
     { \
         _HPyFunc_args_GETATTRFUNC a = { arg0, arg1 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_GETATTRFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_GETATTRFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -230,8 +216,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, cpy_PyObject *arg1) \
     { \
         _HPyFunc_args_GETATTROFUNC a = { arg0, arg1 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_GETATTROFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_GETATTROFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -246,8 +231,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, char *arg1, cpy_PyObject *arg2) \
     { \
         _HPyFunc_args_SETATTRFUNC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_SETATTRFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SETATTRFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -262,8 +246,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, cpy_PyObject *arg1, cpy_PyObject *arg2) \
     { \
         _HPyFunc_args_SETATTROFUNC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_SETATTROFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SETATTROFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -276,8 +259,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_REPRFUNC a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_REPRFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_REPRFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -290,8 +272,7 @@ typedef struct {
     static HPy_hash_t SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_HASHFUNC a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_HASHFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_HASHFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -304,8 +285,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_GETITERFUNC a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_GETITERFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_GETITERFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -318,8 +298,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_ITERNEXTFUNC a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_ITERNEXTFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_ITERNEXTFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -334,8 +313,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, cpy_PyObject *arg1, cpy_PyObject *arg2) \
     { \
         _HPyFunc_args_DESCRGETFUNC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_DESCRGETFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_DESCRGETFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -350,8 +328,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, cpy_PyObject *arg1, cpy_PyObject *arg2) \
     { \
         _HPyFunc_args_DESCRSETFUNC a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_DESCRSETFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_DESCRSETFUNC, IMPL, &a); \
         return a.result; \
     }
 
@@ -365,8 +342,7 @@ typedef struct {
     static cpy_PyObject *SYM(cpy_PyObject *arg0, void *arg1) \
     { \
         _HPyFunc_args_GETTER a = { arg0, arg1 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_GETTER, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_GETTER, IMPL, &a); \
         return a.result; \
     }
 
@@ -381,8 +357,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, cpy_PyObject *arg1, void *arg2) \
     { \
         _HPyFunc_args_SETTER a = { arg0, arg1, arg2 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_SETTER, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SETTER, IMPL, &a); \
         return a.result; \
     }
 
@@ -396,8 +371,7 @@ typedef struct {
     static int SYM(cpy_PyObject *arg0, cpy_PyObject *arg1) \
     { \
         _HPyFunc_args_OBJOBJPROC a = { arg0, arg1 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_OBJOBJPROC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_OBJOBJPROC, IMPL, &a); \
         return a.result; \
     }
 
@@ -409,8 +383,7 @@ typedef struct {
     static void SYM(cpy_PyObject *arg0) \
     { \
         _HPyFunc_args_DESTRUCTOR a = { arg0 }; \
-        _HPy_CallRealFunctionFromTrampoline( \
-           _ctx_for_trampolines, HPyFunc_DESTRUCTOR, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_DESTRUCTOR, IMPL, &a); \
         return; \
     }
 
@@ -18,6 +18,14 @@ HPyAPI_FUNC void HPy_Close(HPyContext *ctx, HPy h) {
      ctx->ctx_Close ( ctx, h ); 
 }
 
+HPyAPI_FUNC void HPy_CloseMany(HPyContext *ctx, const HPy *hs, HPy_ssize_t n) {
+     ctx->ctx_CloseMany ( ctx, hs, n ); 
+}
+
+HPyAPI_FUNC void HPy_DupMany(HPyContext *ctx, const HPy *hs, HPy *out, HPy_ssize_t n) {
+     ctx->ctx_DupMany ( ctx, hs, out, n ); 
+}
+
 HPyAPI_FUNC HPy HPyLong_FromInt32_t(HPyContext *ctx, int32_t value) {
      return ctx->ctx_Long_FromInt32_t ( ctx, value ); 
 }
@@ -254,6 +262,10 @@ HPyAPI_FUNC HPy HPy_CallMethod(HPyContext *ctx, HPy name, const HPy *args, size_
      return ctx->ctx_CallMethod ( ctx, name, args, nargs, kwnames ); 
 }
 
+HPyAPI_FUNC HPy HPy_CallMethodCached(HPyContext *ctx, HPyCallSite *site, const HPy *args, size_t nargs) {
+     return ctx->ctx_CallMethodCached ( ctx, site, args, nargs ); 
+}
+
 HPyAPI_FUNC HPy HPy_GetIter(HPyContext *ctx, HPy obj) {
      return ctx->ctx_GetIter ( ctx, obj ); 
 }
@@ -266,6 +278,10 @@ HPyAPI_FUNC int HPyIter_Check(HPyContext *ctx, HPy obj) {
      return ctx->ctx_Iter_Check ( ctx, obj ); 
 }
 
+HPyAPI_FUNC HPy_ssize_t HPyIter_NextBatch(HPyContext *ctx, HPy obj, HPy *items, HPy_ssize_t n) {
+     return ctx->ctx_Iter_NextBatch ( ctx, obj, items, n ); 
+}
+
 HPyAPI_FUNC HPy HPyErr_SetString(HPyContext *ctx, HPy h_type, const char *utf8_message) {
      ctx->ctx_Err_SetString ( ctx, h_type, utf8_message ); return HPy_NULL; 
 }
@@ -462,6 +478,10 @@ HPyAPI_FUNC HPyType_BuiltinShape _HPyType_GetBuiltinShape(HPyContext *ctx, HPy h
      return ctx->ctx_Type_GetBuiltinShape ( ctx, h_type ); 
 }
 
+HPyAPI_FUNC HPy _HPyStructSequence_New(HPyContext *ctx, HPy type, HPy_ssize_t nargs, const HPy *args) {
+     return ctx->ctx_StructSequence_New ( ctx, type, nargs, args ); 
+}
+
 HPyAPI_FUNC HPy HPy_Repr(HPyContext *ctx, HPy obj) {
      return ctx->ctx_Repr ( ctx, obj ); 
 }
@@ -490,6 +510,22 @@ HPyAPI_FUNC HPy_hash_t HPy_Hash(HPyContext *ctx, HPy obj) {
      return ctx->ctx_Hash ( ctx, obj ); 
 }
 
+HPyAPI_FUNC int HPy_GetBuffer(HPyContext *ctx, HPy obj, HPy_buffer *view, int flags) {
+     return ctx->ctx_GetBuffer ( ctx, obj, view, flags ); 
+}
+
+HPyAPI_FUNC void HPyBuffer_Release(HPyContext *ctx, HPy_buffer *view) {
+     ctx->ctx_Buffer_Release ( ctx, view ); 
+}
+
+HPyAPI_FUNC int HPyBuffer_IsContiguous(HPyContext *ctx, const HPy_buffer *view, char order) {
+     return ctx->ctx_Buffer_IsContiguous ( ctx, view, order ); 
+}
+
+HPyAPI_FUNC int HPyBuffer_ToContiguous(HPyContext *ctx, void *buf, const HPy_buffer *view, HPy_ssize_t len, char order) {
+     return ctx->ctx_Buffer_ToContiguous ( ctx, buf, view, len, order ); 
+}
+
 HPyAPI_FUNC int HPyBytes_Check(HPyContext *ctx, HPy h) {
      return ctx->ctx_Bytes_Check ( ctx, h ); 
 }
@@ -610,6 +646,10 @@ HPyAPI_FUNC HPy HPyDict_Copy(HPyContext *ctx, HPy h) {
      return ctx->ctx_Dict_Copy ( ctx, h ); 
 }
 
+HPyAPI_FUNC int HPyDict_Next(HPyContext *ctx, HPy h, HPy_ssize_t *pos, HPy *key, HPy *value) {
+     return ctx->ctx_Dict_Next ( ctx, h, pos, key, value ); 
+}
+
 HPyAPI_FUNC int HPyTuple_Check(HPyContext *ctx, HPy h) {
      return ctx->ctx_Tuple_Check ( ctx, h ); 
 }
@@ -690,6 +730,26 @@ HPyAPI_FUNC void HPyTupleBuilder_Cancel(HPyContext *ctx, HPyTupleBuilder builder
      ctx->ctx_TupleBuilder_Cancel ( ctx, builder ); 
 }
 
+HPyAPI_FUNC HPyDictBuilder HPyDictBuilder_New(HPyContext *ctx, HPy_ssize_t size) {
+     return ctx->ctx_DictBuilder_New ( ctx, size ); 
+}
+
+HPyAPI_FUNC int HPyDictBuilder_Set(HPyContext *ctx, HPyDictBuilder builder, HPy h_key, HPy h_value) {
+     return ctx->ctx_DictBuilder_Set ( ctx, builder, h_key, h_value ); 
+}
+
+HPyAPI_FUNC int HPyDictBuilder_Set_s(HPyContext *ctx, HPyDictBuilder builder, const char *utf8_key, HPy h_value) {
+     return ctx->ctx_DictBuilder_Set_s ( ctx, builder, utf8_key, h_value ); 
+}
+
+HPyAPI_FUNC HPy HPyDictBuilder_Build(HPyContext *ctx, HPyDictBuilder builder) {
+     return ctx->ctx_DictBuilder_Build ( ctx, builder ); 
+}
+
+HPyAPI_FUNC void HPyDictBuilder_Cancel(HPyContext *ctx, HPyDictBuilder builder) {
+     ctx->ctx_DictBuilder_Cancel ( ctx, builder ); 
+}
+
 HPyAPI_FUNC HPyTracker HPyTracker_New(HPyContext *ctx, HPy_ssize_t size) {
      return ctx->ctx_Tracker_New ( ctx, size ); 
 }
@@ -714,6 +774,14 @@ HPyAPI_FUNC HPy HPyField_Load(HPyContext *ctx, HPy source_object, HPyField sourc
      return ctx->ctx_Field_Load ( ctx, source_object, source_field ); 
 }
 
+HPyAPI_FUNC void HPyField_StoreMany(HPyContext *ctx, HPy target_object, HPyField **target_fields, const HPy *hs, HPy_ssize_t n) {
+     ctx->ctx_Field_StoreMany ( ctx, target_object, target_fields, hs, n ); 
+}
+
+HPyAPI_FUNC void HPyField_LoadMany(HPyContext *ctx, HPy source_object, HPyField **source_fields, HPy *out, HPy_ssize_t n) {
+     ctx->ctx_Field_LoadMany ( ctx, source_object, source_fields, out, n ); 
+}
+
 HPyAPI_FUNC void HPy_ReenterPythonExecution(HPyContext *ctx, HPyThreadState state) {
      ctx->ctx_ReenterPythonExecution ( ctx, state ); 
 }
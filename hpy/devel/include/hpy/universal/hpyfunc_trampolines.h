@@ -3,6 +3,22 @@
 
 /* This file should be autogenerated */
 
+/* Call IMPL, which has the signature SIG, from a trampoline. If the HPy
+   implementation provided a table of direct entry points when loading the
+   module, jump straight to the one for SIG; otherwise, use the generic
+   _HPy_CallRealFunctionFromTrampoline which dispatches on SIG at runtime. */
+#define _HPyFunc_CALL_REAL_FUNCTION(SIG, IMPL, ARGS)                         \
+    do {                                                                     \
+        const _HPyFunc_DirectCallTable *_table =                             \
+            _direct_calls_for_trampolines;                                   \
+        if (_table != NULL && (size_t)(SIG) < _table->size)                  \
+            _table->calls[SIG](_ctx_for_trampolines, (HPyCFunction)IMPL,     \
+                               ARGS);                                        \
+        else                                                                 \
+            _HPy_CallRealFunctionFromTrampoline(                             \
+                _ctx_for_trampolines, SIG, (HPyCFunction)IMPL, ARGS);        \
+    } while (0)
+
 typedef struct {
     cpy_PyObject *self;
     cpy_PyObject *const *args;
@@ -21,6 +37,15 @@ typedef struct {
     cpy_PyObject *result;
 } _HPyFunc_args_KEYWORDS;
 
+typedef struct {
+    cpy_PyObject *self;
+    cpy_PyObject *const *args;
+    size_t nargsf;
+    cpy_PyObject *kwnames;
+    HPyKwTable *kwtable;
+    cpy_PyObject *result;
+} _HPyFunc_args_KWTABLE;
+
 typedef struct {
     cpy_PyObject *self;
     cpy_PyObject *args;
@@ -47,8 +72,7 @@ typedef struct {
     SYM(cpy_PyObject *self, cpy_PyObject *const *args, HPy_ssize_t nargs)   \
     {                                                                       \
         _HPyFunc_args_VARARGS a = { self, args, nargs };                    \
-        _HPy_CallRealFunctionFromTrampoline(                                \
-            _ctx_for_trampolines, HPyFunc_VARARGS, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_VARARGS, IMPL, &a);             \
         return a.result;                                                    \
     }
 
@@ -58,8 +82,20 @@ typedef struct {
             cpy_PyObject *kwnames)                                           \
     {                                                                        \
         _HPyFunc_args_KEYWORDS a = { self, args, nargs, kwnames };           \
-        _HPy_CallRealFunctionFromTrampoline(                                 \
-            _ctx_for_trampolines, HPyFunc_KEYWORDS, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_KEYWORDS, IMPL, &a);             \
+        return a.result;                                                     \
+    }
+
+/* The trampoline of HPyDef_METH_KW also passes the parameter table: the
+   runtime uses it to place the arguments before calling IMPL. NPARAMS is
+   only needed by the CPython ABI. */
+#define _HPyFunc_KWTABLE_TRAMPOLINE(SYM, IMPL, KWTABLE, NPARAMS)             \
+    static cpy_PyObject *                                                    \
+    SYM(cpy_PyObject *self, cpy_PyObject *const *args, size_t nargs,         \
+            cpy_PyObject *kwnames)                                           \
+    {                                                                        \
+        _HPyFunc_args_KWTABLE a = { self, args, nargs, kwnames, KWTABLE };   \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_KWTABLE, IMPL, &a);              \
         return a.result;                                                     \
     }
 
@@ -68,8 +104,7 @@ typedef struct {
     SYM(cpy_PyObject *self, cpy_PyObject *args, cpy_PyObject *kw)            \
     {                                                                        \
         _HPyFunc_args_INITPROC a = { self, args, kw };                       \
-        _HPy_CallRealFunctionFromTrampoline(                                 \
-            _ctx_for_trampolines, HPyFunc_INITPROC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_INITPROC, IMPL, &a);             \
         return a.result;                                                     \
     }
 
@@ -78,8 +113,7 @@ typedef struct {
     SYM(cpy_PyObject *self, cpy_PyObject *args, cpy_PyObject *kw)            \
     {                                                                        \
         _HPyFunc_args_NEWFUNC a = { self, args, kw };                        \
-        _HPy_CallRealFunctionFromTrampoline(                                 \
-            _ctx_for_trampolines, HPyFunc_NEWFUNC, (HPyCFunction)IMPL, &a);  \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_NEWFUNC, IMPL, &a);              \
         return a.result;                                                     \
     }
 
@@ -97,8 +131,7 @@ typedef struct {
     SYM(cpy_PyObject *self, cpy_PyObject *obj, int op)                         \
     {                                                                          \
         _HPyFunc_args_RICHCMPFUNC a = { self, obj, (HPy_RichCmpOp)op };        \
-        _HPy_CallRealFunctionFromTrampoline(                                   \
-           _ctx_for_trampolines, HPyFunc_RICHCMPFUNC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_RICHCMPFUNC, IMPL, &a);            \
         return a.result;                                                       \
     }
 
@@ -113,8 +146,7 @@ typedef struct {
     static int SYM(cpy_PyObject *self, cpy_Py_buffer *view, int flags)           \
     {                                                                            \
         _HPyFunc_args_GETBUFFERPROC a = {self, view, flags};                     \
-        _HPy_CallRealFunctionFromTrampoline(                                     \
-           _ctx_for_trampolines, HPyFunc_GETBUFFERPROC, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_GETBUFFERPROC, IMPL, &a);            \
         return a.result;                                                         \
     }
 
@@ -127,13 +159,49 @@ typedef struct {
     static void SYM(cpy_PyObject *self, cpy_Py_buffer *view)     \
     {                                                            \
         _HPyFunc_args_RELEASEBUFFERPROC a = {self, view};        \
-        _HPy_CallRealFunctionFromTrampoline(                     \
-           _ctx_for_trampolines, HPyFunc_RELEASEBUFFERPROC,      \
-           (HPyCFunction)IMPL, &a);                              \
+        _HPyFunc_CALL_REAL_FUNCTION(                             \
+           HPyFunc_RELEASEBUFFERPROC, IMPL, &a);                 \
         return;                                                  \
     }
 
 
+/* special case: the HPy_tp_iternext_batch slot doesn't map to any CPython
+   slot. The runtime calls the trampoline from HPyIter_NextBatch, with 'items'
+   pointing to an array of at least 'n' elements. */
+typedef struct {
+    cpy_PyObject *self;
+    cpy_PyObject **items;
+    HPy_ssize_t n;
+    HPy_ssize_t result;
+} _HPyFunc_args_ITERNEXTBATCHFUNC;
+
+#define _HPyFunc_TRAMPOLINE_HPyFunc_ITERNEXTBATCHFUNC(SYM, IMPL)             \
+    static HPy_ssize_t                                                       \
+    SYM(cpy_PyObject *self, cpy_PyObject **items, HPy_ssize_t n)             \
+    {                                                                        \
+        _HPyFunc_args_ITERNEXTBATCHFUNC a = { self, items, n };              \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_ITERNEXTBATCHFUNC, IMPL, &a);    \
+        return a.result;                                                     \
+    }
+
+/* special case: CPython's sendfunc returns a PySendResult, which has the same
+   values as HPySendResult, and the value is stored in '*presult' */
+typedef struct {
+    cpy_PyObject *self;
+    cpy_PyObject *value;
+    cpy_PyObject **presult;
+    HPySendResult result;
+} _HPyFunc_args_SENDFUNC;
+
+#define _HPyFunc_TRAMPOLINE_HPyFunc_SENDFUNC(SYM, IMPL)                     \
+    static HPySendResult                                                    \
+    SYM(cpy_PyObject *self, cpy_PyObject *value, cpy_PyObject **presult)    \
+    {                                                                       \
+        _HPyFunc_args_SENDFUNC a = { self, value, presult };                \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_SENDFUNC, IMPL, &a);            \
+        return a.result;                                                    \
+    }
+
 typedef struct {
     cpy_PyObject *self;
     cpy_visitproc visit;
@@ -145,17 +213,15 @@ typedef struct {
     static int SYM(cpy_PyObject *self, cpy_visitproc visit, void *arg) \
     {                                                                  \
         _HPyFunc_args_TRAVERSEPROC a = { self, visit, arg };           \
-        _HPy_CallRealFunctionFromTrampoline(                           \
-           _ctx_for_trampolines, HPyFunc_TRAVERSEPROC,                 \
-           (HPyCFunction)IMPL, &a);                                    \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_TRAVERSEPROC, IMPL, &a);   \
         return a.result;                                               \
     }
 
 #define HPyCapsule_DESTRUCTOR_TRAMPOLINE(SYM, IMPL)                       \
     static void SYM(cpy_PyObject *capsule)                                \
     {                                                                     \
-        _HPy_CallRealFunctionFromTrampoline(_ctx_for_trampolines,         \
-                HPyFunc_CAPSULE_DESTRUCTOR, (HPyCFunction)IMPL, capsule); \
+        _HPyFunc_CALL_REAL_FUNCTION(                                      \
+                HPyFunc_CAPSULE_DESTRUCTOR, IMPL, capsule);               \
     }
 
 typedef struct {
@@ -168,8 +234,7 @@ typedef struct {
     {                                                                         \
         (void) def; /* avoid 'unused' warning */                              \
         _HPyFunc_args_UNARYFUNC a = { spec };                                 \
-        _HPy_CallRealFunctionFromTrampoline(                                  \
-           _ctx_for_trampolines, HPyFunc_MOD_CREATE, (HPyCFunction)IMPL, &a); \
+        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_MOD_CREATE, IMPL, &a);            \
         return a.result;                                                      \
     }
 
@@ -0,0 +1,4 @@
+
+// automatically generated by setup.py:get_scm_config()
+#define HPY_VERSION "0.9.0"
+#define HPY_GIT_REVISION "f075048"
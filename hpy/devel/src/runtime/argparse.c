@@ -524,6 +524,132 @@ error:
     return 0;
 }
 
+/*
+ * Compile a HPyArg_ParsePlan: we strip the '|' marker and the error message
+ * part off the format string, so that HPyArg_ParseWithPlan just needs to
+ * call parse_item for each remaining format unit.
+ */
+static int
+parse_plan_init(HPyContext *ctx, HPyArg_ParsePlan *plan)
+{
+    const char *fmt1 = plan->fmt;
+    const char *err_fmt = NULL;
+    const char *fmt_end = parse_err_fmt(plan->fmt, &err_fmt);
+    size_t n_units = 0;
+    size_t n_required = (size_t)-1;
+    char *units = (char *)malloc(fmt_end - plan->fmt + 1);
+
+    if (units == NULL) {
+        HPyErr_NoMemory(ctx);
+        return 0;
+    }
+    for (; fmt1 != fmt_end; fmt1++) {
+        if (*fmt1 == '|') {
+            if (n_required == (size_t)-1)
+                n_required = n_units;
+            continue;
+        }
+        units[n_units++] = *fmt1;
+    }
+    units[n_units] = '\0';
+    plan->_n_units = n_units;
+    plan->_n_required = n_required == (size_t)-1 ? n_units : n_required;
+    plan->_err_fmt = err_fmt;
+    plan->_units = units;
+    return 1;
+}
+
+/**
+ * Parse positional arguments using a precompiled format string.
+ *
+ * This behaves exactly like :c:func:`HPyArg_Parse` but the format string is
+ * taken from ``plan`` and it is analyzed only once, on first use.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param ht:
+ *     An optional pointer to an HPyTracker (see :c:func:`HPyArg_Parse`).
+ * :param args:
+ *     The array of positional arguments to parse.
+ * :param nargs:
+ *     The number of elements in ``args``.
+ * :param plan:
+ *     A pointer to a ``HPyArg_ParsePlan`` whose field ``fmt`` is initialized
+ *     with the format string. All other fields must be zero-initialized.
+ *     Usually, the plan is a ``static`` variable.
+ * :param ...:
+ *     A va_list of references to variables in which to store the parsed
+ *     arguments. The number and types of the arguments should match the
+ *     the format string ``plan->fmt``.
+ *
+ * :returns: ``0`` on failure, ``1`` on success.
+ *
+ * Example:
+ *
+ * .. code-block:: c
+ *
+ *     static HPyArg_ParsePlan plan = { "ll" };
+ *     long a, b;
+ *     if (!HPyArg_ParseWithPlan(ctx, NULL, args, nargs, &plan, &a, &b))
+ *         return HPy_NULL;
+ *     ...
+ */
+HPyAPI_HELPER int
+HPyArg_ParseWithPlan(HPyContext *ctx, HPyTracker *ht, const HPy *args,
+                     size_t nargs, HPyArg_ParsePlan *plan, ...)
+{
+    const char *units;
+    size_t i;
+    HPy current_arg;
+
+    if (plan->_units == NULL && !parse_plan_init(ctx, plan)) {
+        return 0;
+    }
+    units = plan->_units;
+
+    if (ht != NULL) {
+        *ht = HPyTracker_New(ctx, 0);
+        if (HPy_IsNull(*ht)) {
+            return 0;
+        }
+    }
+
+    va_list vl;
+    va_start(vl, plan);
+
+    for (i = 0; i < plan->_n_units; i++) {
+        current_arg = HPy_NULL;
+        if (i < nargs) {
+            current_arg = args[i];
+        }
+        if (!HPy_IsNull(current_arg) || i >= plan->_n_required) {
+            if (!parse_item(ctx, ht, current_arg, 0, &units, &vl, plan->_err_fmt)) {
+                goto error;
+            }
+        }
+        else {
+            set_error(ctx, ctx->h_TypeError, plan->_err_fmt,
+                "required positional argument missing");
+            goto error;
+        }
+    }
+    if (i < nargs) {
+        set_error(ctx, ctx->h_TypeError, plan->_err_fmt,
+            "mismatched args (too many arguments for fmt)");
+        goto error;
+    }
+
+    va_end(vl);
+    return 1;
+
+error:
+    va_end(vl);
+    if (ht != NULL) {
+        HPyTracker_Close(ctx, *ht);
+    }
+    return 0;
+}
+
 static HPy
 find_keyword(HPyContext *ctx, HPy kwnames, HPy_ssize_t n_kwnames, const HPy *args, const char *key)
 {
@@ -540,10 +666,113 @@ find_keyword(HPyContext *ctx, HPy kwnames, HPy_ssize_t n_kwnames, const HPy *arg
     return HPy_NULL;
 }
 
+/*
+ * Lazily initialize a HPyArg_KeywordsParser: count and check the keyword
+ * names and create the corresponding unicode objects once.
+ */
+static int
+keywords_parser_init(HPyContext *ctx, HPyArg_KeywordsParser *parser,
+                     const char *err_fmt)
+{
+    const char **keywords = parser->keywords;
+    HPy_ssize_t nkw = 0;
+    HPy_ssize_t i;
+    HPy *h_names;
+    HPyGlobal *kwnames;
+
+    while (keywords[nkw] != NULL && !*keywords[nkw]) {
+        nkw++;
+    }
+    while (keywords[nkw] != NULL) {
+        if (!*keywords[nkw]) {
+            set_error(ctx, ctx->h_SystemError, err_fmt,
+                "empty keyword parameter name");
+            return 0;
+        }
+        nkw++;
+    }
+
+    h_names = (HPy *)calloc(nkw + 1, sizeof(HPy));
+    kwnames = (HPyGlobal *)calloc(nkw + 1, sizeof(HPyGlobal));
+    if (h_names == NULL || kwnames == NULL) {
+        free(h_names);
+        free(kwnames);
+        HPyErr_NoMemory(ctx);
+        return 0;
+    }
+    for (i = 0; i < nkw; i++) {
+        if (!*keywords[i])
+            continue;
+        h_names[i] = HPyUnicode_FromString(ctx, keywords[i]);
+        if (HPy_IsNull(h_names[i]))
+            goto error;
+    }
+    for (i = 0; i < nkw; i++) {
+        if (!HPy_IsNull(h_names[i])) {
+            HPyGlobal_Store(ctx, &kwnames[i], h_names[i]);
+            HPy_Close(ctx, h_names[i]);
+        }
+    }
+    free(h_names);
+    parser->_nkw = nkw;
+    parser->_kwnames = kwnames;
+    return 1;
+
+error:
+    for (i = 0; i < nkw; i++) {
+        HPy_Close(ctx, h_names[i]);
+    }
+    free(h_names);
+    free(kwnames);
+    return 0;
+}
+
+/*
+ * Like find_keyword but for a HPyArg_KeywordsParser: the names in 'kwnames'
+ * are usually interned strings, so we first look for the very same object and
+ * fall back to comparing for equality only if that fails. In the latter case,
+ * we remember the matching object so that subsequent calls from the same
+ * call site will take the fast path.
+ */
+static HPy
+find_keyword_cached(HPyContext *ctx, HPyArg_KeywordsParser *parser, size_t idx,
+                    HPy kwnames, HPy_ssize_t n_kwnames, const HPy *args)
+{
+    HPy h_key = HPyGlobal_Load(ctx, parser->_kwnames[idx]);
+    HPy result = HPy_NULL;
+    HPy_ssize_t i;
+
+    for (i = 0; i < n_kwnames; i++) {
+        HPy kwname = HPy_GetItem_i(ctx, kwnames, i);
+        int is = HPy_Is(ctx, kwname, h_key);
+        HPy_Close(ctx, kwname);
+        if (is) {
+            result = args[i];
+            goto done;
+        }
+    }
+    for (i = 0; i < n_kwnames; i++) {
+        HPy kwname = HPy_GetItem_i(ctx, kwnames, i);
+        int eq = HPy_RichCompareBool(ctx, kwname, h_key, HPy_EQ);
+        if (eq > 0) {
+            HPyGlobal_Store(ctx, &parser->_kwnames[idx], kwname);
+        }
+        HPy_Close(ctx, kwname);
+        if (eq > 0) {
+            result = args[i];
+            break;
+        }
+    }
+done:
+    HPy_Close(ctx, h_key);
+    return result;
+}
+
 static int
 parse_keywords(HPyContext *ctx, HPyTracker *ht, const HPy *args,
                size_t nargs, HPy kw, int kwnames, const char *fmt,
-               const char *keywords[], va_list *p_va)
+               const char *keywords[], HPyArg_KeywordsParser *parser,
+               va_list *p_va)
 {
     const char *fmt1 = fmt;
     const char *err_fmt = NULL;
@@ -561,18 +790,27 @@ parse_keywords(HPyContext *ctx, HPyTracker *ht, const HPy *args,
 
     fmt_end = parse_err_fmt(fmt, &err_fmt);
 
-    // first count positional only arguments
-    while (keywords[nkw] != NULL && !*keywords[nkw]) {
-        nkw++;
-    }
-    // then check and count the rest
-    while (keywords[nkw] != NULL) {
-        if (!*keywords[nkw]) {
-            set_error(ctx, ctx->h_SystemError, err_fmt,
-                "empty keyword parameter name");
+    if (parser != NULL) {
+        if (parser->_kwnames == NULL &&
+                !keywords_parser_init(ctx, parser, err_fmt)) {
             return 0;
         }
-        nkw++;
+        nkw = parser->_nkw;
+    }
+    else {
+        // first count positional only arguments
+        while (keywords[nkw] != NULL && !*keywords[nkw]) {
+            nkw++;
+        }
+        // then check and count the rest
+        while (keywords[nkw] != NULL) {
+            if (!*keywords[nkw]) {
+                set_error(ctx, ctx->h_SystemError, err_fmt,
+                    "empty keyword parameter name");
+                return 0;
+            }
+            nkw++;
+        }
     }
 
     if (ht != NULL) {
@@ -625,8 +863,12 @@ parse_keywords(HPyContext *ctx, HPyTracker *ht, const HPy *args,
         }
         else if (!HPy_IsNull(kw) && *keywords[i]) {
             if (kwnames) {
-                current_arg = find_keyword(ctx, kw, n_kwnames, args+nargs,
-                                           keywords[i]);
+                if (parser != NULL)
+                    current_arg = find_keyword_cached(ctx, parser, i, kw,
+                                                      n_kwnames, args+nargs);
+                else
+                    current_arg = find_keyword(ctx, kw, n_kwnames, args+nargs,
+                                               keywords[i]);
                 /*
                  * Clear any error that was raised. If an error was raised
                  * current_arg will be HPy_NULL and will be handled
@@ -760,7 +1002,72 @@ HPyArg_ParseKeywords(HPyContext *ctx, HPyTracker *ht, const HPy *args,
     va_list va;
 
     va_start(va, keywords);
-    retval = parse_keywords(ctx, ht, args, nargs, kwnames, 1, fmt, keywords, &va);
+    retval = parse_keywords(ctx, ht, args, nargs, kwnames, 1, fmt, keywords,
+                            NULL, &va);
+    va_end(va);
+    return retval;
+}
+
+/**
+ * Parse positional and keyword arguments using a precompiled parser.
+ *
+ * This behaves exactly like :c:func:`HPyArg_ParseKeywords` but the format
+ * string and the keyword names are taken from ``parser``, which is meant to
+ * be a ``static`` variable at the call site. On first use, the parser creates
+ * a unicode object for each keyword name and keeps it alive forever. Keyword
+ * names passed by the caller are first matched by identity (which is the
+ * common case since Python interns the keyword names of call sites) and only
+ * then by equality. Hence, in the common case, parsing does not allocate any
+ * memory.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param ht:
+ *     An optional pointer to an HPyTracker (see
+ *     :c:func:`HPyArg_ParseKeywords`).
+ * :param args:
+ *     The array of positional arguments to parse.
+ * :param nargs:
+ *     The number of elements in ``args``.
+ * :param kwnames:
+ *     A handle to the tuple of keyword argument names (may be ``HPy_NULL``).
+ *     The values of the keyword arguments are appended to ``args``. Argument
+ *     ``nargs`` does not include the keyword argument count.
+ * :param parser:
+ *     A pointer to a ``HPyArg_KeywordsParser`` whose fields ``fmt`` and
+ *     ``keywords`` have the same meaning as the corresponding arguments of
+ *     :c:func:`HPyArg_ParseKeywords`. The other fields must be
+ *     zero-initialized.
+ * :param ...:
+ *     A va_list of references to variables in which to store the parsed
+ *     arguments. The number and types of the arguments should match the
+ *     the format string ``parser->fmt``.
+ *
+ * :returns: ``0`` on failure, ``1`` on success.
+ *
+ * Example:
+ *
+ * .. code-block:: c
+ *
+ *     static const char *kwlist[] = { "a", "b", NULL };
+ *     static HPyArg_KeywordsParser parser = { "ll", kwlist };
+ *     long a, b;
+ *     if (!HPyArg_ParseKeywordsWithParser(ctx, NULL, args, nargs, kwnames,
+ *                                         &parser, &a, &b))
+ *         return HPy_NULL;
+ *     ...
+ */
+HPyAPI_HELPER int
+HPyArg_ParseKeywordsWithParser(HPyContext *ctx, HPyTracker *ht,
+                               const HPy *args, size_t nargs, HPy kwnames,
+                               HPyArg_KeywordsParser *parser, ...)
+{
+    int retval;
+    va_list va;
+
+    va_start(va, parser);
+    retval = parse_keywords(ctx, ht, args, nargs, kwnames, 1, parser->fmt,
+                            parser->keywords, parser, &va);
     va_end(va);
     return retval;
 }
@@ -813,7 +1120,8 @@ HPyArg_ParseKeywordsDict(HPyContext *ctx, HPyTracker *ht, const HPy *args,
     va_list va;
 
     va_start(va, keywords);
-    retval = parse_keywords(ctx, ht, args, nargs, kw, 0, fmt, keywords, &va);
+    retval = parse_keywords(ctx, ht, args, nargs, kw, 0, fmt, keywords,
+                            NULL, &va);
     va_end(va);
     return retval;
 }
@@ -95,6 +95,7 @@
 #include "hpy.h"
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 
 #define MESSAGE_BUF_SIZE 128
 
@@ -103,6 +104,19 @@ static HPy build_tuple(HPyContext *ctx, const char **fmt, va_list *values, HPy_s
 static HPy build_list(HPyContext *ctx, const char **fmt, va_list *values, HPy_ssize_t size);
 static HPy build_dict(HPyContext *ctx, const char **fmt, va_list *values);
 static HPy build_single(HPyContext *ctx, const char **fmt, va_list *values, int *needs_close);
+static HPy build_unit(HPyContext *ctx, char format_char, va_list *values, int *needs_close);
+
+/* An operation of a compiled HPy_BuildValuePlan. Collections are stored in
+   prefix order: the op of the collection is followed by the ops of its
+   items. */
+typedef struct _HPyBuildValueOp_s {
+    char format_char;
+    HPy_ssize_t size;  /* number of items (or pairs) for '(', '[' and '{' */
+} HPyBuildValueOp;
+
+static int compile_plan(HPyContext *ctx, HPy_BuildValuePlan *plan);
+static HPy exec_tuple(HPyContext *ctx, const HPyBuildValueOp **ops, va_list *values, HPy_ssize_t size);
+static HPy exec_single(HPyContext *ctx, const HPyBuildValueOp **ops, va_list *values, int *needs_close);
 
 /**
  * Creates a new value based on a format string from the values passed in
@@ -143,6 +157,61 @@ HPy HPy_BuildValue(HPyContext *ctx, const char *fmt, ...)
     return result;
 }
 
+/**
+ * Like :c:func:`HPy_BuildValue` but the format string is taken from ``plan``
+ * and it is parsed only once, on first use. Subsequent calls only execute the
+ * compiled plan, so this is meant for hot call sites.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param plan:
+ *     A pointer to a ``HPy_BuildValuePlan`` whose field ``fmt`` is
+ *     initialized with the format string. All other fields must be
+ *     zero-initialized. Usually, the plan is a ``static`` variable.
+ * :param ...:
+ *     Variable arguments according to the provided format string.
+ *
+ * :returns:
+ *     A handle to the built Python value or ``HPy_NULL`` in case of errors.
+ *
+ * Example:
+ *
+ * .. code-block:: c
+ *
+ *     static HPy_BuildValuePlan plan = { "ii" };
+ *     return HPy_BuildValueWithPlan(ctx, &plan, a, b);
+ *
+ * .. note::
+ *
+ *    The compiled plan is never freed.
+ */
+HPyAPI_HELPER
+HPy HPy_BuildValueWithPlan(HPyContext *ctx, HPy_BuildValuePlan *plan, ...)
+{
+    va_list values;
+    HPy result;
+    const HPyBuildValueOp *ops;
+
+    if (plan->_ops == NULL && compile_plan(ctx, plan) < 0) {
+        return HPy_NULL;
+    }
+    ops = plan->_ops;
+    va_start(values, plan);
+    if (plan->_size == 0) {
+        result = HPy_Dup(ctx, ctx->h_None);
+    } else if (plan->_size == 1) {
+        int needs_close;
+        result = exec_single(ctx, &ops, &values, &needs_close);
+        if (!needs_close) {
+            result = HPy_Dup(ctx, result);
+        }
+    } else {
+        result = exec_tuple(ctx, &ops, &values, plan->_size);
+    }
+    va_end(values);
+    return result;
+}
+
 static HPy_ssize_t count_items(HPyContext *ctx, const char *fmt, char end)
 {
     HPy_ssize_t level = 0, result = 0;
@@ -227,6 +296,16 @@ static HPy build_single(HPyContext *ctx, const char **fmt, va_list *values, int
             return build_dict(ctx, fmt, values);
         }
 
+        default:
+            return build_unit(ctx, format_char, values, needs_close);
+    } // switch
+}
+
+/* Build the value of a single format unit which is not a collection */
+static HPy build_unit(HPyContext *ctx, char format_char, va_list *values, int *needs_close)
+{
+    *needs_close = 1;
+    switch (format_char) {
         case 'i':
             return HPyLong_FromLong(ctx, (long)va_arg(*values, int));
 
@@ -429,3 +508,248 @@ static HPy build_tuple(HPyContext *ctx, const char **fmt, va_list *values, HPy_s
     }
     return HPyTupleBuilder_Build(ctx, builder);
 }
+
+/* ~~~ compilation and execution of HPy_BuildValuePlan ~~~
+
+   The compile_* functions mirror the build_* functions above, but instead of
+   building values they emit ops. This way, a plan reports the very same
+   errors as HPy_BuildValue for a malformed format string. The exec_*
+   functions then just follow the ops, there is no need to re-check the
+   format string or to count items.
+*/
+
+static int compile_single(HPyContext *ctx, const char **fmt, HPyBuildValueOp *ops, HPy_ssize_t *n_ops);
+
+static int compile_items(HPyContext *ctx, const char **fmt, HPyBuildValueOp *ops, HPy_ssize_t *n_ops,
+                         HPy_ssize_t size, char expected_end)
+{
+    for (HPy_ssize_t i = 0; i < size; ++i) {
+        if (compile_single(ctx, fmt, ops, n_ops) < 0) {
+            return -1;
+        }
+        if (**fmt == ',') {
+            (*fmt)++;
+        }
+    }
+    if (**fmt != expected_end) {
+        if (expected_end == '\0') {
+            HPyErr_SetString(ctx, ctx->h_SystemError, "internal error in HPy_BuildValue");
+        } else {
+            // same message as build_tuple and build_list
+            HPyErr_SetString(ctx, ctx->h_SystemError,
+                             "unmatched '[' in the format string passed to HPy_BuildValue");
+        }
+        return -1;
+    }
+    if (expected_end != '\0') {
+        ++*fmt;
+    }
+    return 0;
+}
+
+static int compile_dict(HPyContext *ctx, const char **fmt, HPyBuildValueOp *ops, HPy_ssize_t *n_ops,
+                        HPyBuildValueOp *dict_op)
+{
+    int expect_comma = 0;
+    while (**fmt != '}' && **fmt != '\0') {
+        if (**fmt == ' ') {
+            (*fmt)++;
+            continue;
+        }
+        if (**fmt == ',') {
+            if (!expect_comma) {
+                HPyErr_SetString(ctx, ctx->h_SystemError,
+                    "unexpected ',' in the format string passed to HPy_BuildValue");
+                return -1;
+            }
+            (*fmt)++;
+            expect_comma = 0;
+            continue;
+        } else {
+            if (expect_comma) {
+                HPyErr_SetString(ctx, ctx->h_SystemError,
+                    "missing ',' in the format string passed to HPy_BuildValue");
+                return -1;
+            }
+        }
+        if (compile_single(ctx, fmt, ops, n_ops) < 0) {
+            return -1;
+        }
+        if (**fmt != ':') {
+            HPyErr_SetString(ctx, ctx->h_SystemError,
+                            "missing ':' in the format string passed to HPy_BuildValue");
+            return -1;
+        }
+        (*fmt)++;
+        if (compile_single(ctx, fmt, ops, n_ops) < 0) {
+            return -1;
+        }
+        dict_op->size++;
+        expect_comma = 1;
+    }
+    if (**fmt != '}') {
+        HPyErr_SetString(ctx, ctx->h_SystemError,
+                         "unmatched '{' in the format string passed to HPy_BuildValue");
+        return -1;
+    }
+    ++*fmt;
+    return 0;
+}
+
+static int compile_single(HPyContext *ctx, const char **fmt, HPyBuildValueOp *ops, HPy_ssize_t *n_ops)
+{
+    HPyBuildValueOp *op = &ops[(*n_ops)++];
+    op->format_char = *(*fmt)++;
+    op->size = 0;
+    switch (op->format_char) {
+        case '(':
+        case '[': {
+            char end = op->format_char == '(' ? ')' : ']';
+            op->size = count_items(ctx, *fmt, end);
+            if (op->size < 0) {
+                return -1;
+            }
+            return compile_items(ctx, fmt, ops, n_ops, op->size, end);
+        }
+
+        case '{':
+            return compile_dict(ctx, fmt, ops, n_ops, op);
+
+        case 'i':
+        case 'I':
+        case 'k':
+        case 'l':
+        case 'L':
+        case 'K':
+        case 'n':
+        case 's':
+        case 'O':
+        case 'S':
+        case 'f':
+        case 'd':
+            return 0;
+
+        default: {
+            // report the same error as build_unit
+            int needs_close;
+            build_unit(ctx, op->format_char, NULL, &needs_close);
+            return -1;
+        }
+    } // switch
+}
+
+static int compile_plan(HPyContext *ctx, HPy_BuildValuePlan *plan)
+{
+    const char *fmt = plan->fmt;
+    HPy_ssize_t n_ops = 0;
+    HPyBuildValueOp *ops;
+    HPy_ssize_t size = count_items(ctx, fmt, '\0');
+    if (size < 0) {
+        return -1;
+    }
+    // every op consumes at least one character of the format string
+    ops = (HPyBuildValueOp *)calloc(strlen(fmt) + 1, sizeof(HPyBuildValueOp));
+    if (ops == NULL) {
+        HPyErr_NoMemory(ctx);
+        return -1;
+    }
+    if ((size == 1 && compile_single(ctx, &fmt, ops, &n_ops) < 0) ||
+            (size > 1 && compile_items(ctx, &fmt, ops, &n_ops, size, '\0') < 0)) {
+        free(ops);
+        return -1;
+    }
+    plan->_size = size;
+    plan->_ops = ops;
+    return 0;
+}
+
+static HPy exec_dict(HPyContext *ctx, const HPyBuildValueOp **ops, va_list *values, HPy_ssize_t size)
+{
+    HPy dict = HPyDict_New(ctx);
+    if (HPy_IsNull(dict)) {
+        return HPy_NULL;
+    }
+    for (HPy_ssize_t i = 0; i < size; ++i) {
+        int needs_key_close, needs_value_close;
+        HPy key = exec_single(ctx, ops, values, &needs_key_close);
+        if (HPy_IsNull(key)) {
+            HPy_Close(ctx, dict);
+            return HPy_NULL;
+        }
+        HPy value = exec_single(ctx, ops, values, &needs_value_close);
+        if (HPy_IsNull(value)) {
+            if (needs_key_close) {
+                HPy_Close(ctx, key);
+            }
+            HPy_Close(ctx, dict);
+            return HPy_NULL;
+        }
+        int res = HPy_SetItem(ctx, dict, key, value);
+        if (needs_key_close) {
+            HPy_Close(ctx, key);
+        }
+        if (needs_value_close) {
+            HPy_Close(ctx, value);
+        }
+        if (res < 0) {
+            HPy_Close(ctx, dict);
+            return HPy_NULL;
+        }
+    }
+    return dict;
+}
+
+static HPy exec_list(HPyContext *ctx, const HPyBuildValueOp **ops, va_list *values, HPy_ssize_t size)
+{
+    HPyListBuilder builder = HPyListBuilder_New(ctx, size);
+    for (HPy_ssize_t i = 0; i < size; ++i) {
+        int needs_close;
+        HPy item = exec_single(ctx, ops, values, &needs_close);
+        if (HPy_IsNull(item)) {
+            HPyListBuilder_Cancel(ctx, builder);
+            return HPy_NULL;
+        }
+        HPyListBuilder_Set(ctx, builder, i, item);
+        if (needs_close) {
+            HPy_Close(ctx, item);
+        }
+    }
+    return HPyListBuilder_Build(ctx, builder);
+}
+
+static HPy exec_tuple(HPyContext *ctx, const HPyBuildValueOp **ops, va_list *values, HPy_ssize_t size)
+{
+    HPyTupleBuilder builder = HPyTupleBuilder_New(ctx, size);
+    for (HPy_ssize_t i = 0; i < size; ++i) {
+        int needs_close;
+        HPy item = exec_single(ctx, ops, values, &needs_close);
+        if (HPy_IsNull(item)) {
+            HPyTupleBuilder_Cancel(ctx, builder);
+            return HPy_NULL;
+        }
+        HPyTupleBuilder_Set(ctx, builder, i, item);
+        if (needs_close) {
+            HPy_Close(ctx, item);
+        }
+    }
+    return HPyTupleBuilder_Build(ctx, builder);
+}
+
+static HPy exec_single(HPyContext *ctx, const HPyBuildValueOp **ops, va_list *values, int *needs_close)
+{
+    const HPyBuildValueOp *op = (*ops)++;
+    *needs_close = 1;
+    switch (op->format_char) {
+        case '(':
+            return exec_tuple(ctx, ops, values, op->size);
+
+        case '[':
+            return exec_list(ctx, ops, values, op->size);
+
+        case '{':
+            return exec_dict(ctx, ops, values, op->size);
+
+        default:
+            return build_unit(ctx, op->format_char, values, needs_close);
+    } // switch
+}
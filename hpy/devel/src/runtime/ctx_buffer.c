@@ -0,0 +1,53 @@
+#include <Python.h>
+#include "hpy.h"
+#include "hpy/runtime/ctx_funcs.h"
+
+#ifndef HPY_ABI_CPYTHON
+   // for _h2py and _py2h
+#  include "handles.h"
+#endif
+
+/* HPy_buffer has the same layout as Py_buffer (the trampolines of
+   HPy_bf_getbuffer rely on it, too), and HPy has the same size as
+   PyObject*. So, the view is filled by CPython in place and only 'obj' needs
+   to be converted: this way, the buffer machinery of the exporter (including
+   'internal') is never copied. */
+
+_HPy_HIDDEN int
+ctx_GetBuffer(HPyContext *ctx, HPy h_obj, HPy_buffer *view, int flags)
+{
+    Py_buffer *pyview = (Py_buffer *)view;
+    if (PyObject_GetBuffer(_h2py(h_obj), pyview, flags) < 0) {
+        view->obj = HPy_NULL;
+        return -1;
+    }
+    // the reference owned by the view becomes the handle owned by the view
+    PyObject *exporter = pyview->obj;
+    view->obj = _py2h(exporter);
+    return 0;
+}
+
+_HPy_HIDDEN void
+ctx_Buffer_Release(HPyContext *ctx, HPy_buffer *view)
+{
+    Py_buffer *pyview = (Py_buffer *)view;
+    PyObject *exporter = _h2py(view->obj);
+    pyview->obj = exporter;
+    // this also releases the reference and sets 'obj' to NULL
+    PyBuffer_Release(pyview);
+}
+
+_HPy_HIDDEN int
+ctx_Buffer_IsContiguous(HPyContext *ctx, const HPy_buffer *view, char order)
+{
+    // 'obj' is not used
+    return PyBuffer_IsContiguous((const Py_buffer *)view, order);
+}
+
+_HPy_HIDDEN int
+ctx_Buffer_ToContiguous(HPyContext *ctx, void *buf, const HPy_buffer *view,
+                        HPy_ssize_t len, char order)
+{
+    // 'obj' is not used
+    return PyBuffer_ToContiguous(buf, (const Py_buffer *)view, len, order);
+}
@@ -77,6 +77,25 @@ ctx_Call(HPyContext *ctx, HPy h_callable, const HPy *h_args, size_t nargs, HPy h
 #    undef PyObject_Vectorcall
 #endif
 
+/* 'args[0]' is a free slot, the receiver is 'args[1]' */
+static PyObject *
+vectorcall_method(PyObject *name, PyObject **args, size_t nargs,
+                  PyObject *kwnames)
+{
+#if PY_VERSION_HEX < 0x03090000
+    PyObject *method = PyObject_GetAttr(args[1], name);
+    if (method == NULL)
+        return NULL;
+    PyObject *result = _PyObject_Vectorcall(method, &args[2],
+                 (nargs-1) | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
+    Py_DECREF(method);
+    return result;
+#else
+    return PyObject_VectorcallMethod(name, args+1,
+                 nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
+#endif
+}
+
 _HPy_HIDDEN HPy
 ctx_CallMethod(HPyContext *ctx, HPy h_name, const HPy *h_args, size_t nargs,
                HPy h_kwnames)
@@ -103,17 +122,129 @@ ctx_CallMethod(HPyContext *ctx, HPy h_name, const HPy *h_args, size_t nargs,
     for (size_t i = 0; i < n_all_args; i++) {
         args[i+1] = _h2py(h_args[i]);
     }
+    result = vectorcall_method(_h2py(h_name), args, nargs, kwnames);
+    return _py2h(result);
+}
+
+/* Create the name objects of 'site' on first use */
+static int
+call_site_init(HPyCallSite *site)
+{
+    PyObject *name = PyUnicode_InternFromString(site->name);
+    if (name == NULL)
+        return -1;
+    PyObject *kwnames = NULL;
+    size_t nkw = 0;
+    if (site->kwnames != NULL) {
+        while (site->kwnames[nkw] != NULL)
+            nkw++;
+        kwnames = PyTuple_New((Py_ssize_t)nkw);
+        if (kwnames == NULL)
+            goto error;
+        for (size_t i = 0; i < nkw; i++) {
+            PyObject *kw = PyUnicode_InternFromString(site->kwnames[i]);
+            if (kw == NULL)
+                goto error;
+            PyTuple_SET_ITEM(kwnames, i, kw);
+        }
+    }
+    site->_kwnames = kwnames;
+    site->_nkw = nkw;
+    // set last, since it marks the site as initialized
+    site->_name = name;
+    return 0;
+error:
+    Py_DECREF(name);
+    Py_XDECREF(kwnames);
+    return -1;
+}
+
+#ifndef PYPY_VERSION
+/* Return the version tag of 'tp' or 0 if it does not have a valid one. The
+   valid tags are unique, so a tag identifies both the type and the state of
+   its dict (and of the ones of its bases). */
+static inline unsigned int
+valid_version_tag(PyTypeObject *tp)
+{
+#ifdef Py_TPFLAGS_VALID_VERSION_TAG
+    if (!PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        return 0;
+#endif
+    return tp->tp_version_tag;
+}
+
+/* Return a borrowed reference to the method descriptor to call for the
+   instances of 'tp', or NULL if the normal method lookup must be used
+   instead. The method is cached in 'site' for the last type seen. */
+static PyObject *
+call_site_lookup(HPyCallSite *site, PyTypeObject *tp)
+{
+    unsigned int tag = valid_version_tag(tp);
+    if (tag != 0 && tag == site->_version_tag)
+        return (PyObject *)site->_method;
+
+    /* the method found in the type can only be used if the instance cannot
+       shadow it and if there is no custom __getattribute__ */
+    if (tp->tp_getattro != PyObject_GenericGetAttr || tp->tp_dictoffset != 0)
+        return NULL;
+#ifdef Py_TPFLAGS_MANAGED_DICT
+    if (PyType_HasFeature(tp, Py_TPFLAGS_MANAGED_DICT))
+        return NULL;
+#endif
+    /* _PyType_Lookup also assigns a version tag to 'tp' if needed */
+    PyObject *descr = _PyType_Lookup(tp, (PyObject *)site->_name);
+    if (descr == NULL ||
+            !PyType_HasFeature(Py_TYPE(descr), Py_TPFLAGS_METHOD_DESCRIPTOR))
+        return NULL;
+    tag = valid_version_tag(tp);
+    if (tag == 0)
+        return NULL;
+    PyObject *old = (PyObject *)site->_method;
+    Py_INCREF(descr);
+    site->_method = descr;
+    site->_version_tag = tag;
+    Py_XDECREF(old);
+    return descr;
+}
+#endif
 
 #if PY_VERSION_HEX < 0x03090000
-    PyObject *method = PyObject_GetAttr(args[1], _h2py(h_name));
-    if (method == NULL)
+#    define PyObject_Vectorcall _PyObject_Vectorcall
+#endif
+
+_HPy_HIDDEN HPy
+ctx_CallMethodCached(HPyContext *ctx, HPyCallSite *site, const HPy *h_args,
+                     size_t nargs)
+{
+    PyObject *result;
+    assert(nargs >= 1);
+    if (site->_name == NULL && call_site_init(site) < 0)
         return HPy_NULL;
-    result = _PyObject_Vectorcall(method, &args[2],
-                 (nargs-1) | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
-    Py_DECREF(method);
-#else
-    result = PyObject_VectorcallMethod(_h2py(h_name), args+1,
-                 nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
+
+    /* see ctx_Call for the reason of the additional first element */
+    size_t n_all_args = nargs + site->_nkw;
+    PyObject **args = (PyObject **) alloca(
+                          (n_all_args + 1) * sizeof(PyObject *));
+    for (size_t i = 0; i < n_all_args; i++) {
+        args[i+1] = _h2py(h_args[i]);
+    }
+    PyObject *kwnames = (PyObject *)site->_kwnames;
+
+#ifndef PYPY_VERSION
+    PyObject *method = call_site_lookup(site, Py_TYPE(args[1]));
+    if (method != NULL) {
+        /* the call might replace the method cached in the site */
+        Py_INCREF(method);
+        result = PyObject_Vectorcall(method, args+1,
+                     nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, kwnames);
+        Py_DECREF(method);
+        return _py2h(result);
+    }
 #endif
+    result = vectorcall_method((PyObject *)site->_name, args, nargs, kwnames);
     return _py2h(result);
 }
+
+#if PY_VERSION_HEX < 0x03090000
+#    undef PyObject_Vectorcall
+#endif
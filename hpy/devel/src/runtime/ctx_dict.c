@@ -0,0 +1,33 @@
+#include <Python.h>
+#include "hpy.h"
+#include "hpy/runtime/ctx_funcs.h"
+
+#ifndef HPY_ABI_CPYTHON
+   // for _h2py and _py2h
+#  include "handles.h"
+#endif
+
+
+_HPy_HIDDEN int
+ctx_Dict_Next(HPyContext *ctx, HPy h, HPy_ssize_t *pos, HPy *h_key,
+              HPy *h_value)
+{
+    PyObject *dict = _h2py(h);
+    PyObject *key, *value;
+    if (dict == NULL || !PyDict_Check(dict)) {
+        PyErr_BadInternalCall();
+        return -1;
+    }
+    if (!PyDict_Next(dict, pos, &key, &value))
+        return 0;
+    // PyDict_Next returns borrowed references
+    if (h_key != NULL) {
+        Py_INCREF(key);
+        *h_key = _py2h(key);
+    }
+    if (h_value != NULL) {
+        Py_INCREF(value);
+        *h_value = _py2h(value);
+    }
+    return 1;
+}
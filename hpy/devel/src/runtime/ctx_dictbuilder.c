@@ -0,0 +1,72 @@
+#include <stddef.h>
+#include <Python.h>
+#include "hpy.h"
+#include "hpy/runtime/ctx_funcs.h"
+
+#ifndef HPY_ABI_CPYTHON
+   // for _h2py and _py2h
+#  include "handles.h"
+#endif
+
+/* _PyDict_NewPresized is available before 3.13 only: it was moved to the
+   internal API in 3.13. On 3.13+ (and on PyPy) the dict is not presized at
+   all and 'size' is ignored. */
+#if PY_VERSION_HEX < 0x030D0000 && !defined(PYPY_VERSION)
+#  define new_presized_dict(size) _PyDict_NewPresized(size)
+#else
+#  define new_presized_dict(size) PyDict_New()
+#endif
+
+
+_HPy_HIDDEN HPyDictBuilder
+ctx_DictBuilder_New(HPyContext *ctx, HPy_ssize_t size)
+{
+    PyObject *dict = new_presized_dict(size);
+    if (dict == NULL)
+        PyErr_Clear();   /* delay the MemoryError */
+    return (HPyDictBuilder){(HPy_ssize_t)dict};
+}
+
+_HPy_HIDDEN int
+ctx_DictBuilder_Set(HPyContext *ctx, HPyDictBuilder builder,
+                    HPy h_key, HPy h_value)
+{
+    PyObject *dict = (PyObject *)builder._dict;
+    if (dict == NULL)
+        return 0;   /* the MemoryError is raised by the build function */
+    return PyDict_SetItem(dict, _h2py(h_key), _h2py(h_value));
+}
+
+_HPy_HIDDEN int
+ctx_DictBuilder_Set_s(HPyContext *ctx, HPyDictBuilder builder,
+                      const char *utf8_key, HPy h_value)
+{
+    PyObject *dict = (PyObject *)builder._dict;
+    if (dict == NULL)
+        return 0;   /* the MemoryError is raised by the build function */
+    return PyDict_SetItemString(dict, utf8_key, _h2py(h_value));
+}
+
+_HPy_HIDDEN HPy
+ctx_DictBuilder_Build(HPyContext *ctx, HPyDictBuilder builder)
+{
+    PyObject *dict = (PyObject *)builder._dict;
+    if (dict == NULL) {
+        PyErr_NoMemory();
+        return HPy_NULL;
+    }
+    builder._dict = 0;
+    return _py2h(dict);
+}
+
+_HPy_HIDDEN void
+ctx_DictBuilder_Cancel(HPyContext *ctx, HPyDictBuilder builder)
+{
+    PyObject *dict = (PyObject *)builder._dict;
+    if (dict == NULL) {
+        // see ctx_TupleBuilder_Cancel
+        return;
+    }
+    builder._dict = 0;
+    Py_XDECREF(dict);
+}
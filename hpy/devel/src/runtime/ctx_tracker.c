@@ -146,10 +146,7 @@ _HPy_HIDDEN void
 ctx_Tracker_Close(HPyContext *ctx, HPyTracker ht)
 {
     _HPyTracker_s *hp = _ht2hp(ht);
-    HPy_ssize_t i;
-    for (i=0; i<hp->length; i++) {
-        HPy_Close(ctx, hp->handles[i]);
-    }
+    HPy_CloseMany(ctx, hp->handles, hp->length);
     free(hp->handles);
     free(hp);
 }
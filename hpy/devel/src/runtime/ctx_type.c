@@ -133,6 +133,10 @@ typedef struct {
     HPyFunc_traverseproc tp_traverse_impl;
     HPyFunc_destroyfunc tp_destroy_impl;
     cpy_vectorcallfunc tp_vectorcall_default_trampoline;
+    cpy_iternextbatchfunc tp_iternext_batch_trampoline;
+    /* the tp_iternext installed by HPy_tp_iternext: the batch function is
+       used only as long as the type still has it */
+    void *tp_iternext_trampoline;
     HPyType_BuiltinShape shape;
     char name[];
 } HPyType_Extra_t;
@@ -284,6 +288,7 @@ sig2flags(HPyFunc_Signature sig)
     switch(sig) {
         case HPyFunc_VARARGS:  return METH_FASTCALL;
         case HPyFunc_KEYWORDS: return METH_FASTCALL | METH_KEYWORDS;
+        case HPyFunc_KWTABLE:  return METH_FASTCALL | METH_KEYWORDS;
         case HPyFunc_NOARGS:   return METH_NOARGS;
         case HPyFunc_O:        return METH_O;
         default:               return -1;
@@ -320,6 +325,7 @@ HPyDef_count(HPyDef *defs[], HPyDef_Kind kind)
         if (defs[i]->kind == kind
                 && !is_bf_slot(defs[i])
                 && !is_slot(defs[i], HPy_tp_destroy)
+                && !is_slot(defs[i], HPy_tp_iternext_batch)
                 && !is_slot(defs[i], HPy_tp_call))
             res++;
     return res;
@@ -363,6 +369,105 @@ hpy_slot_to_cpy_slot(HPySlot_Slot src)
 }
 
 
+/* Intern the parameter names of an HPyDef_METH_KW method. The table belongs
+   to the HPyDef, so this is done only the first time that the method is
+   added to a type or module; like the PyMethodDefs, the names are never
+   freed. */
+static int
+kwtable_init(HPyKwTable *kwtable)
+{
+    if (kwtable->_kwnames != NULL)
+        return 0;
+    HPy_ssize_t n = kwtable->nparams;
+    PyObject **kwnames = (PyObject **)PyMem_Calloc(n + 1, sizeof(PyObject *));
+    if (kwnames == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        if (kwtable->kwlist[i] == NULL) {
+            PyErr_Format(PyExc_SystemError,
+                         "%s(): kwlist has fewer than %zd names",
+                         kwtable->name, n);
+            goto error;
+        }
+        kwnames[i] = PyUnicode_InternFromString(kwtable->kwlist[i]);
+        if (kwnames[i] == NULL)
+            goto error;
+    }
+    kwtable->_kwnames = kwnames;
+    return 0;
+
+ error:
+    for (HPy_ssize_t i = 0; i < n; i++)
+        Py_XDECREF(kwnames[i]);
+    PyMem_Free(kwnames);
+    return -1;
+}
+
+static HPy_ssize_t
+kwtable_lookup(HPyKwTable *kwtable, PyObject *key)
+{
+    HPy_ssize_t n = kwtable->nparams;
+    // fast path: the keyword names of a call are usually interned
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        if (kwtable->_kwnames[i] == key)
+            return i;
+    }
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        int eq = PyObject_RichCompareBool(kwtable->_kwnames[i], key, Py_EQ);
+        if (eq != 0)
+            return eq < 0 ? -2 : i;
+    }
+    return -1;
+}
+
+/* Place the arguments of a vectorcall into 'params', which has room for
+   kwtable->nparams items, in the order of the parameter list. The items of
+   the parameters which are not given are set to NULL. The references are
+   borrowed from 'args'. */
+_HPy_HIDDEN int
+_HPyKwTable_PlaceArgs(HPyKwTable *kwtable, PyObject *const *args,
+                      size_t nargsf, PyObject *kwnames, PyObject **params)
+{
+    HPy_ssize_t n = kwtable->nparams;
+    HPy_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+    if (nargs > n) {
+        PyErr_Format(PyExc_TypeError,
+                     "%s() takes at most %zd arguments (%zd given)",
+                     kwtable->name, n, nargs);
+        return -1;
+    }
+    HPy_ssize_t i = 0;
+    for (; i < nargs; i++)
+        params[i] = args[i];
+    for (; i < n; i++)
+        params[i] = NULL;
+    if (kwnames == NULL)
+        return 0;
+    HPy_ssize_t nkw = PyTuple_GET_SIZE(kwnames);
+    for (HPy_ssize_t k = 0; k < nkw; k++) {
+        PyObject *key = PyTuple_GET_ITEM(kwnames, k);
+        HPy_ssize_t j = kwtable_lookup(kwtable, key);
+        if (j == -2)
+            return -1;
+        if (j == -1) {
+            PyErr_Format(PyExc_TypeError,
+                         "%s() got an unexpected keyword argument '%U'",
+                         kwtable->name, key);
+            return -1;
+        }
+        if (params[j] != NULL) {
+            PyErr_Format(PyExc_TypeError,
+                         "%s() got multiple values for argument '%U'",
+                         kwtable->name, key);
+            return -1;
+        }
+        params[j] = args[nargs + k];
+    }
+    return 0;
+}
+
 /*
  * Create a PyMethodDef which contains:
  *     1. All HPyMeth contained in hpyspec->defines
@@ -408,6 +513,19 @@ create_method_defs(HPyDef *hpydefs[], PyMethodDef *legacy_methods)
                 return NULL;
             }
             dst->ml_doc = src->meth.doc;
+            if (src->meth.signature == HPyFunc_KWTABLE) {
+                if (src->meth.kwtable == NULL) {
+                    PyMem_Free(result);
+                    PyErr_SetString(PyExc_ValueError,
+                                    "HPyMeth with signature HPyFunc_KWTABLE "
+                                    "needs a kwtable");
+                    return NULL;
+                }
+                if (kwtable_init(src->meth.kwtable) < 0) {
+                    PyMem_Free(result);
+                    return NULL;
+                }
+            }
         }
     }
     // copy the legacy methods
@@ -419,13 +537,112 @@ create_method_defs(HPyDef *hpydefs[], PyMethodDef *legacy_methods)
     return result;
 }
 
-// see the comment in create_member_defs below
+/* Some kinds of members are implemented as getsets instead of PyMemberDefs:
+   the objects, because in the universal mode they are stored in HPyFields,
+   and the most common numeric types, because a getter which knows the type
+   of the field is faster than the generic PyMember_GetOne/PyMember_SetOne.
+   The closure of those getsets is a MemberClosure, whose offset includes the
+   size of the header of the builtin shape: it is computed once when the type
+   is created, so the getters don't need to compute the payload. */
+typedef struct {
+    HPy_ssize_t offset;
+    const char *name;
+} MemberClosure;
+
+#define MEMBER_FIELD(TYPE, SELF, CLOSURE) \
+    ((TYPE *)((char *)(SELF) + ((MemberClosure *)(CLOSURE))->offset))
+
+static int member_delete_error(void)
+{
+    PyErr_SetString(PyExc_TypeError, "can't delete numeric/char attribute");
+    return -1;
+}
+
+static PyObject *member_double_get(PyObject *self, void *closure)
+{
+    return PyFloat_FromDouble(*MEMBER_FIELD(double, self, closure));
+}
+
+static int member_double_set(PyObject *self, PyObject *value, void *closure)
+{
+    if (value == NULL)
+        return member_delete_error();
+    double v = PyFloat_AsDouble(value);
+    if (v == -1.0 && PyErr_Occurred())
+        return -1;
+    *MEMBER_FIELD(double, self, closure) = v;
+    return 0;
+}
+
+static PyObject *member_long_get(PyObject *self, void *closure)
+{
+    return PyLong_FromLong(*MEMBER_FIELD(long, self, closure));
+}
+
+static int member_long_set(PyObject *self, PyObject *value, void *closure)
+{
+    if (value == NULL)
+        return member_delete_error();
+    long v = PyLong_AsLong(value);
+    if (v == -1 && PyErr_Occurred())
+        return -1;
+    *MEMBER_FIELD(long, self, closure) = v;
+    return 0;
+}
+
+static PyObject *member_longlong_get(PyObject *self, void *closure)
+{
+    return PyLong_FromLongLong(*MEMBER_FIELD(long long, self, closure));
+}
+
+static int member_longlong_set(PyObject *self, PyObject *value, void *closure)
+{
+    if (value == NULL)
+        return member_delete_error();
+    long long v = PyLong_AsLongLong(value);
+    if (v == -1 && PyErr_Occurred())
+        return -1;
+    *MEMBER_FIELD(long long, self, closure) = v;
+    return 0;
+}
+
+static PyObject *member_ssize_get(PyObject *self, void *closure)
+{
+    return PyLong_FromSsize_t(*MEMBER_FIELD(HPy_ssize_t, self, closure));
+}
+
+static int member_ssize_set(PyObject *self, PyObject *value, void *closure)
+{
+    if (value == NULL)
+        return member_delete_error();
+    Py_ssize_t v = PyLong_AsSsize_t(value);
+    if (v == -1 && PyErr_Occurred())
+        return -1;
+    *MEMBER_FIELD(HPy_ssize_t, self, closure) = v;
+    return 0;
+}
+
+static PyObject *member_bool_get(PyObject *self, void *closure)
+{
+    return PyBool_FromLong(*MEMBER_FIELD(char, self, closure));
+}
+
+static int member_bool_set(PyObject *self, PyObject *value, void *closure)
+{
+    if (value == NULL)
+        return member_delete_error();
+    if (!PyBool_Check(value)) {
+        PyErr_SetString(PyExc_TypeError, "attribute value type must be bool");
+        return -1;
+    }
+    *MEMBER_FIELD(char, self, closure) = (value == Py_True);
+    return 0;
+}
+
 #ifndef HPY_ABI_CPYTHON
 static PyObject *member_object_get(PyObject *self, void *closure)
 {
-    HPyMember *member = (HPyMember *)closure;
-    HPy_ssize_t offset = member->offset;
-    HPyField *field = (HPyField *)(((char *)self) + offset);
+    HPyField *field = MEMBER_FIELD(HPyField, self, closure);
     if (HPyField_IsNull(*field)) {
         Py_INCREF(Py_None);
         return Py_None;
@@ -437,13 +654,11 @@ static PyObject *member_object_get(PyObject *self, void *closure)
 
 static PyObject *member_object_ex_get(PyObject *self, void *closure)
 {
-    HPyMember *member = (HPyMember *)closure;
-    HPy_ssize_t offset = member->offset;
-    HPyField *field = (HPyField *)(((char *)self) + offset);
+    HPyField *field = MEMBER_FIELD(HPyField, self, closure);
     if (HPyField_IsNull(*field)) {
         PyErr_Format(PyExc_AttributeError,
                      "'%.50s' object has no attribute '%s'",
-                     Py_TYPE(self)->tp_name, member->name);
+                     Py_TYPE(self)->tp_name, ((MemberClosure *)closure)->name);
         return NULL;
     }
     PyObject *value = _hf2py(*field);
@@ -453,9 +668,7 @@ static PyObject *member_object_ex_get(PyObject *self, void *closure)
 
 static int member_object_set(PyObject *self, PyObject *value, void *closure)
 {
-    HPyMember *member = (HPyMember *)closure;
-    HPy_ssize_t offset = member->offset;
-    HPyField *field = (HPyField *)(((char *)self) + offset);
+    HPyField *field = MEMBER_FIELD(HPyField, self, closure);
     PyObject *old_value = _hf2py(*field);
     Py_XINCREF(value);
     *field = _py2hf(value);
@@ -464,6 +677,86 @@ static int member_object_set(PyObject *self, PyObject *value, void *closure)
 }
 #endif
 
+/* Return true if the member must be implemented as a getset, and store its
+   getter and setter in *get and *set. */
+static bool
+member_getset_kernels(HPyMember *member, getter *get, setter *set)
+{
+    switch (member->type) {
+#ifndef HPY_ABI_CPYTHON
+    // for the universal mode, we need to do load the HPyField that is
+    // stored in the object properly. In CPython ABI mode, these can be
+    // safely read as PyObject* directly without the overhead of getset.
+    case HPyMember_OBJECT:
+        *get = member_object_get;
+        *set = member_object_set;
+        break;
+    case HPyMember_OBJECT_EX:
+        *get = member_object_ex_get;
+        *set = member_object_set;
+        break;
+#endif
+    case HPyMember_DOUBLE:
+        *get = member_double_get;
+        *set = member_double_set;
+        break;
+    case HPyMember_LONG:
+        *get = member_long_get;
+        *set = member_long_set;
+        break;
+    case HPyMember_LONGLONG:
+        *get = member_longlong_get;
+        *set = member_longlong_set;
+        break;
+    case HPyMember_HPYSSIZET:
+        // CPython looks for '__vectorcalloffset__' in the PyMemberDefs
+        if (is_vectorcalloffset_member(member->name))
+            return false;
+        *get = member_ssize_get;
+        *set = member_ssize_set;
+        break;
+    case HPyMember_BOOL:
+        *get = member_bool_get;
+        *set = member_bool_set;
+        break;
+    default:
+        return false;
+    }
+    if (member->readonly)
+        *set = NULL;
+    return true;
+}
+
+/* Return true if 'get' is one of the getters set by member_getset_kernels,
+   i.e. if the closure is a MemberClosure which was allocated for it */
+static bool is_member_getter(getter get)
+{
+    return
+#ifndef HPY_ABI_CPYTHON
+        get == member_object_get ||
+        get == member_object_ex_get ||
+#endif
+        get == member_double_get ||
+        get == member_long_get ||
+        get == member_longlong_get ||
+        get == member_ssize_get ||
+        get == member_bool_get;
+}
+
+/* Free the result of create_getset_defs and create_member_defs, including
+   the MemberClosures. This must only be used if the type could not be
+   created: otherwise, the getsets are referenced by the type. */
+static void free_getset_defs(PyGetSetDef *getsets)
+{
+    if (getsets == NULL)
+        return;
+    for (PyGetSetDef *def = getsets; def->name != NULL; def++) {
+        if (is_member_getter(def->get))
+            PyMem_Free(def->closure);
+    }
+    PyMem_Free(getsets);
+}
+
 static PyMemberDef *
 create_member_defs(HPyDef *hpydefs[], PyMemberDef *legacy_members,
                    HPy_ssize_t base_member_offset, PyGetSetDef **getsets,
@@ -503,6 +796,10 @@ create_member_defs(HPyDef *hpydefs[], PyMemberDef *legacy_members,
         return NULL;
     }
     int dst_idx = 0;
+    int getsetcnt = 0;
+    while ((*getsets)[getsetcnt].name) {
+        getsetcnt++;
+    }
 
     // add vectorcalloffset if 'HPy_tp_call' was specified
     if (implicit_vectorcalloffset) {
@@ -519,39 +816,32 @@ create_member_defs(HPyDef *hpydefs[], PyMemberDef *legacy_members,
             HPyDef *src = hpydefs[i];
             if (src->kind != HPyDef_Kind_Member)
                 continue;
-#ifndef HPY_ABI_CPYTHON
-            // for the universal mode, we need to do load the HPyField that is
-            // stored in the object properly. In CPython ABI mode, these can be
-            // safely read as PyObject* directly without the overhead of getset.
-            if (src->member.type == HPyMember_OBJECT || src->member.type == HPyMember_OBJECT_EX) {
-                int getsetcnt = 0;
-                while ((*getsets)[getsetcnt].name) {
-                    getsetcnt++;
-                }
-                *getsets = (PyGetSetDef*)PyMem_Realloc(*getsets, (getsetcnt + 2) * sizeof(PyGetSetDef));
-                if (!*getsets) {
+            getter get;
+            setter set;
+            if (member_getset_kernels(&src->member, &get, &set)) {
+                MemberClosure *closure =
+                    (MemberClosure *)PyMem_Malloc(sizeof(MemberClosure));
+                PyGetSetDef *new_getsets = (PyGetSetDef*)PyMem_Realloc(
+                        *getsets, (getsetcnt + 2) * sizeof(PyGetSetDef));
+                if (closure == NULL || new_getsets == NULL) {
+                    PyMem_Free(closure);
+                    PyMem_Free(result);
+                    PyErr_NoMemory();
                     return NULL;
                 }
+                *getsets = new_getsets;
+                closure->offset = src->member.offset + base_member_offset;
+                closure->name = src->member.name;
                 PyGetSetDef *dst = &(*getsets)[getsetcnt++];
                 dst->name = src->member.name;
-                if (src->member.type == HPyMember_OBJECT_EX) {
-                    dst->get = member_object_ex_get;
-                } else {
-                    dst->get = member_object_get;
-                }
-                if (!src->member.readonly) {
-                    dst->set = member_object_set;
-                } else {
-                    dst->set = NULL;
-                }
+                dst->get = get;
+                dst->set = set;
                 dst->doc = src->member.doc;
-                src->member.offset = src->member.offset + base_member_offset;
-                dst->closure = (void *)&src->member;
+                dst->closure = closure;
                 (*getsets)[getsetcnt] = (PyGetSetDef){NULL};
                 total_count--;
                 continue;
             }
-#endif
             PyMemberDef *dst = &result[dst_idx++];
             dst->name = src->member.name;
             dst->type = src->member.type;
@@ -582,6 +872,7 @@ create_member_defs(HPyDef *hpydefs[], PyMemberDef *legacy_members,
     /* Enforce constraint that we cannot have slot 'HPy_tp_call' and an explicit
        member '__vectorcalloffset__'. */
     if (implicit_vectorcalloffset && explicit_vectorcalloffset) {
+        PyMem_Free(result);
         PyErr_SetString(PyExc_TypeError,
                 "Cannot have HPy_tp_call and explicit member"
                 "'__vectorcalloffset__'. Specify just one of them.");
@@ -691,6 +982,19 @@ create_slot_defs(HPyType_Spec *hpyspec, HPyType_Extra_t *extra,
                 extra->tp_destroy_impl = (HPyFunc_destroyfunc)src->slot.impl;
                 continue;   /* we don't have a trampoline for tp_destroy */
             }
+#if PY_VERSION_HEX < 0x030A0000
+            if (is_slot(src, HPy_am_send)) {
+                /* Py_am_send does not exist before 3.10: the awaitable is
+                   resumed through tp_iternext instead */
+                continue;
+            }
+#endif
+            if (is_slot(src, HPy_tp_iternext_batch)) {
+                /* no CPython slot: only used by HPyIter_NextBatch */
+                extra->tp_iternext_batch_trampoline =
+                        (cpy_iternextbatchfunc)src->slot.cpy_trampoline;
+                continue;
+            }
             if (is_slot(src, HPy_tp_call)) {
                 /* Slot 'HPy_tp_call' will add a hidden field to
                    the type's struct. The field can only be appended which
@@ -733,6 +1037,8 @@ create_slot_defs(HPyType_Spec *hpyspec, HPyType_Extra_t *extra,
             }
             if (is_slot(src, HPy_tp_new)) {
                 has_tp_new = true;
+            } else if (is_slot(src, HPy_tp_iternext)) {
+                extra->tp_iternext_trampoline = (void *)src->slot.cpy_trampoline;
             } else if (is_slot(src, HPy_tp_traverse)) {
                 extra->tp_traverse_impl = (HPyFunc_traverseproc)src->slot.impl;
                 /* no 'continue' here: we have a trampoline too */
@@ -742,6 +1048,13 @@ create_slot_defs(HPyType_Spec *hpyspec, HPyType_Extra_t *extra,
             dst->pfunc = (void*)src->slot.cpy_trampoline;
         }
     }
+    if (extra->tp_iternext_batch_trampoline != NULL &&
+            extra->tp_iternext_trampoline == NULL) {
+        PyMem_Free(result);
+        PyErr_SetString(PyExc_TypeError,
+                "HPy_tp_iternext_batch requires HPy_tp_iternext");
+        return NULL;
+    }
 
     /* Since the basicsize may be modified depending on special HPy slots, we
        defer determination of the base_member_offset to this point. */
@@ -784,7 +1097,8 @@ create_slot_defs(HPyType_Spec *hpyspec, HPyType_Extra_t *extra,
     // prepare the "real" members, which may introduce getsetdefs in universal mode
     PyMemberDef *pymembers = create_member_defs(hpyspec->defines, legacy_member_defs, base_member_offset, &pygetsets, &vectorcalloffset, *basicsize);
     if (pymembers == NULL) {
-        PyMem_Free(pygetsets);
+        // the getsets may already contain MemberClosures
+        free_getset_defs(pygetsets);
         PyMem_Free(pymethods);
         PyMem_Free(result);
         return NULL;
@@ -836,6 +1150,29 @@ create_slot_defs(HPyType_Spec *hpyspec, HPyType_Extra_t *extra,
     return result;
 }
 
+/* Free the getsets of the result of create_slot_defs, see free_getset_defs */
+static void free_slot_getset_defs(PyType_Slot *slots)
+{
+    for (int i = 0; slots[i].slot != 0; i++) {
+        if (slots[i].slot == Py_tp_getset) {
+            free_getset_defs((PyGetSetDef *)slots[i].pfunc);
+            return;
+        }
+    }
+}
+
+/* Release a type which failed a check after it was created. If this was the
+   last reference, its getsets (and their MemberClosures) are no longer used
+   and can be freed. */
+static void discard_new_type(PyObject *type)
+{
+    PyGetSetDef *getsets = ((PyTypeObject *)type)->tp_getset;
+    bool last_reference = Py_REFCNT(type) == 1;
+    Py_DECREF(type);
+    if (last_reference)
+        free_getset_defs(getsets);
+}
+
 /* Python 3.8 and older is the missing Py_bf_getbuffer and Py_bf_releasebuffer
    so we need to define those functions here. Since Python 3.9, we can just use
    the function pointer types from Python. */
@@ -1334,12 +1671,14 @@ ctx_Type_FromSpec(HPyContext *ctx, HPyType_Spec *hpyspec,
 
     PyObject *bases = build_bases_from_params(params);
     if (PyErr_Occurred()) {
+        free_slot_getset_defs(spec->slots);
         PyMem_Free(spec->slots);
         PyMem_Free(spec);
         return HPy_NULL;
     }
     struct _typeobject *metatype = get_metatype(params);
     if (metatype == NULL && PyErr_Occurred()) {
+        free_slot_getset_defs(spec->slots);
         PyMem_Free(spec->slots);
         PyMem_Free(spec);
         return HPy_NULL;
@@ -1358,6 +1697,8 @@ ctx_Type_FromSpec(HPyContext *ctx, HPyType_Spec *hpyspec,
        create_method_defs, because that one is referenced internally by
        CPython (which probably assumes it's statically allocated) */
     Py_XDECREF(bases);
+    if (result == NULL)
+        free_slot_getset_defs(spec->slots);
     PyMem_Free(spec->slots);
     PyMem_Free(spec);
     if (result == NULL) {
@@ -1381,12 +1722,12 @@ ctx_Type_FromSpec(HPyContext *ctx, HPyType_Spec *hpyspec,
         ((PyTypeObject*)result)->tp_as_buffer = buffer_procs;
     } else {
         if (PyErr_Occurred()) {
-            Py_DECREF(result);
+            discard_new_type(result);
             return HPy_NULL;
         }
     }
     if (check_inheritance_constraints((PyTypeObject *) result) < 0) {
-        Py_DECREF(result);
+        discard_new_type(result);
         return HPy_NULL;
     }
     assert(_is_HPyType((PyTypeObject*) result));
@@ -1631,3 +1972,47 @@ _HPy_HIDDEN int ctx_SetCallFunction(HPyContext *ctx, HPy h,
     _HPy_set_vectorcall_func(tp, obj, func->cpy_trampoline);
     return 0;
 }
+
+_HPy_HIDDEN HPy_ssize_t ctx_Iter_NextBatch(HPyContext *ctx, HPy h_iter,
+                                           HPy *items, HPy_ssize_t n)
+{
+    PyObject *it = _h2py(h_iter);
+    assert(it != NULL);
+    PyTypeObject *tp = Py_TYPE(it);
+    if (!PyIter_Check(it)) {
+        PyErr_Format(PyExc_TypeError, "'%.200s' object is not an iterator",
+                     tp->tp_name);
+        return -1;
+    }
+    if (n <= 0)
+        return 0;
+    /* HPy and PyObject* have the same size, so the objects can be stored in
+       'items' and converted in place */
+    PyObject **objs = (PyObject **)items;
+    HPy_ssize_t i;
+    if (_is_HPyType(tp)) {
+        HPyType_Extra_t *extra = _HPyType_EXTRA(tp);
+        if (extra->tp_iternext_batch_trampoline != NULL &&
+                (void *)tp->tp_iternext == extra->tp_iternext_trampoline) {
+            HPy_ssize_t res = extra->tp_iternext_batch_trampoline(it, objs, n);
+            if (res < 0)
+                return -1;
+            assert(res <= n);
+            for (i = 0; i < res; i++)
+                items[i] = _py2h(objs[i]);
+            return res;
+        }
+    }
+    for (i = 0; i < n; i++) {
+        PyObject *item = PyIter_Next(it);
+        if (item == NULL)
+            break;
+        items[i] = _py2h(item);
+    }
+    if (PyErr_Occurred()) {
+        while (i > 0)
+            Py_DECREF(_h2py(items[--i]));
+        return -1;
+    }
+    return i;
+}
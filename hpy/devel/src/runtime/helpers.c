@@ -1,5 +1,7 @@
 #include "hpy.h"
 
+#include <string.h> // for strcmp
+
 /**
  * Create a type and add it as an attribute on the given object. The type is
  * created using :c:func:`HPyType_FromSpec`. The object is often a module that the type
@@ -58,6 +60,33 @@ HPyHelpers_AddType(HPyContext *ctx, HPy obj, const char *name,
     return 1;
 }
 
+static HPy
+build_kwargs_dict(HPyContext *ctx, const HPy *values, HPy kwnames,
+                  HPy_ssize_t nkw)
+{
+    HPy kwd, tmp;
+    HPy_ssize_t i;
+
+    kwd = HPyDict_New(ctx);
+    if (HPy_IsNull(kwd)) {
+        return HPy_NULL;
+    }
+    for (i=0; i < nkw; i++) {
+        tmp = HPy_GetItem_i(ctx, kwnames, i);
+        if (HPy_IsNull(tmp)) {
+            HPy_Close(ctx, kwd);
+            return HPy_NULL;
+        }
+        if (HPy_SetItem(ctx, kwd, tmp, values[i]) < 0) {
+            HPy_Close(ctx, tmp);
+            HPy_Close(ctx, kwd);
+            return HPy_NULL;
+        }
+        HPy_Close(ctx, tmp);
+    }
+    return kwd;
+}
+
 /**
  * Convert positional/keyword argument vector to argument tuple and keywords
  * dictionary.
@@ -102,8 +131,8 @@ HPyAPI_HELPER int
 HPyHelpers_PackArgsAndKeywords(HPyContext *ctx, const HPy *args, size_t nargs,
                                HPy kwnames, HPy *out_pos_args, HPy *out_kwd)
 {
-    HPy pos_args, kwd, tmp;
-    HPy_ssize_t nkw, i;
+    HPy pos_args, kwd;
+    HPy_ssize_t nkw;
 
     if (out_pos_args == NULL) {
         HPyErr_SetString(ctx, ctx->h_SystemError,
@@ -120,19 +149,9 @@ HPyHelpers_PackArgsAndKeywords(HPyContext *ctx, const HPy *args, size_t nargs,
     if (nkw < 0) {
         return 0;
     } else if (nkw > 0) {
-        kwd = HPyDict_New(ctx);
-        for (i=0; i < nkw; i++) {
-            tmp = HPy_GetItem_i(ctx, kwnames, i);
-            if (HPy_IsNull(tmp)) {
-                HPy_Close(ctx, kwd);
-                return 0;
-            }
-            if (HPy_SetItem(ctx, kwd, tmp, args[nargs + i]) < 0) {
-                HPy_Close(ctx, tmp);
-                HPy_Close(ctx, kwd);
-                return 0;
-            }
-            HPy_Close(ctx, tmp);
+        kwd = build_kwargs_dict(ctx, args + nargs, kwnames, nkw);
+        if (HPy_IsNull(kwd)) {
+            return 0;
         }
     } else {
         assert(nkw == 0);
@@ -152,3 +171,212 @@ HPyHelpers_PackArgsAndKeywords(HPyContext *ctx, const HPy *args, size_t nargs,
     *out_kwd = kwd;
     return 1;
 }
+
+#define FORWARD_CALL_SMALL_ARGS 16
+
+/**
+ * Call ``callable`` with the arguments of a call using HPy's calling
+ * convention, without converting them to a tuple and a dictionary.
+ *
+ * This is useful if a function using HPy's calling convention just forwards
+ * its arguments to another callable (e.g. to a Python-level implementation):
+ * unlike :c:func:`HPyHelpers_PackArgsAndKeywords`, it does not allocate
+ * anything for the arguments unless ``first`` is given and there are more than
+ * a few arguments.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param callable:
+ *     A handle to the object to call (must not be ``HPy_NULL``).
+ * :param first:
+ *     If not ``HPy_NULL``, it is passed as first positional argument, before
+ *     the ones in ``args`` (e.g. to forward a call to a function expecting
+ *     ``self``).
+ * :param args:
+ *     A pointer to an array of positional and keyword arguments, like for
+ *     :c:func:`HPy_Call`.
+ * :param nargs:
+ *     The number of positional arguments in ``args``.
+ * :param kwnames:
+ *     A handle to the tuple of keyword argument names (may be ``HPy_NULL``).
+ *
+ * :returns:
+ *     The result of the call on success, or ``HPy_NULL`` in case of an error.
+ */
+HPyAPI_HELPER HPy
+HPyHelpers_ForwardCall(HPyContext *ctx, HPy callable, HPy first,
+                       const HPy *args, size_t nargs, HPy kwnames)
+{
+    HPy small_args[FORWARD_CALL_SMALL_ARGS];
+    HPy *new_args, result;
+    HPy_ssize_t nkw, i;
+
+    if (HPy_IsNull(first)) {
+        return HPy_Call(ctx, callable, args, nargs, kwnames);
+    }
+    nkw = HPy_IsNull(kwnames) ? 0 : HPy_Length(ctx, kwnames);
+    if (nkw < 0) {
+        return HPy_NULL;
+    }
+    if (nargs + nkw + 1 <= FORWARD_CALL_SMALL_ARGS) {
+        new_args = small_args;
+    } else {
+        new_args = (HPy *)malloc((nargs + nkw + 1) * sizeof(HPy));
+        if (new_args == NULL) {
+            return HPyErr_NoMemory(ctx);
+        }
+    }
+    new_args[0] = first;
+    for (i = 0; i < (HPy_ssize_t)nargs + nkw; i++) {
+        new_args[i + 1] = args[i];
+    }
+    result = HPy_Call(ctx, callable, new_args, nargs + 1, kwnames);
+    if (new_args != small_args) {
+        free(new_args);
+    }
+    return result;
+}
+
+/**
+ * Initialize a view on the keyword arguments of a call using HPy's calling
+ * convention. The keyword arguments can then be looked up by name with
+ * :c:func:`HPyKwargsView_Get_s`, and a dictionary is only created if
+ * :c:func:`HPyKwargsView_AsDict` is called, e.g. because the arguments are
+ * passed to legacy code.
+ *
+ * The view borrows ``args`` and ``kwnames``, which must stay valid until
+ * :c:func:`HPyKwargsView_Close` is called.
+ *
+ * Example:
+ *
+ * .. code-block:: c
+ *
+ *     HPyKwargsView kw;
+ *     HPy value, kwd;
+ *     if (!HPyKwargsView_Init(ctx, &kw, args, nargs, kwnames))
+ *         return HPy_NULL;
+ *     if (HPyKwargsView_Get_s(ctx, &kw, "fast", &value) == 1) {
+ *         // use 'value' (borrowed)
+ *     }
+ *     else if (HPyKwargsView_AsDict(ctx, &kw, &kwd)) {
+ *         // pass 'kwd' (borrowed, may be HPy_NULL) to legacy code
+ *     }
+ *     HPyKwargsView_Close(ctx, &kw);
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param view:
+ *     The view to initialize.
+ * :param args:
+ *     A pointer to an array of positional and keyword arguments.
+ * :param nargs:
+ *     The number of positional arguments in ``args``.
+ * :param kwnames:
+ *     A handle to the tuple of keyword argument names (may be ``HPy_NULL``).
+ *
+ * :returns: ``0`` on failure, ``1`` on success.
+ */
+HPyAPI_HELPER int
+HPyKwargsView_Init(HPyContext *ctx, HPyKwargsView *view, const HPy *args,
+                   size_t nargs, HPy kwnames)
+{
+    HPy_ssize_t nkw = HPy_IsNull(kwnames) ? 0 : HPy_Length(ctx, kwnames);
+    if (nkw < 0) {
+        return 0;
+    }
+    view->_values = args + nargs;
+    view->_kwnames = kwnames;
+    view->_nkw = nkw;
+    view->_dict = HPy_NULL;
+    return 1;
+}
+
+/**
+ * Return the number of keyword arguments in the view.
+ */
+HPyAPI_HELPER HPy_ssize_t
+HPyKwargsView_Size(HPyKwargsView *view)
+{
+    return view->_nkw;
+}
+
+/**
+ * Look up a keyword argument by name, without creating a dictionary.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param view:
+ *     An initialized view.
+ * :param name:
+ *     The name of the keyword argument as UTF-8 encoded C string.
+ * :param out:
+ *     A pointer to a variable where to write the value of the keyword
+ *     argument, if found. The handle is borrowed from the arguments of the
+ *     call and must not be closed.
+ *
+ * :returns: ``1`` if found, ``0`` if not found, ``-1`` in case of an error.
+ */
+HPyAPI_HELPER int
+HPyKwargsView_Get_s(HPyContext *ctx, HPyKwargsView *view, const char *name,
+                    HPy *out)
+{
+    HPy_ssize_t i;
+    for (i = 0; i < view->_nkw; i++) {
+        HPy h_key = HPy_GetItem_i(ctx, view->_kwnames, i);
+        if (HPy_IsNull(h_key)) {
+            return -1;
+        }
+        const char *key = HPyUnicode_AsUTF8AndSize(ctx, h_key, NULL);
+        int found = key != NULL && strcmp(key, name) == 0;
+        HPy_Close(ctx, h_key);
+        if (key == NULL) {
+            return -1;
+        }
+        if (found) {
+            *out = view->_values[i];
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Get the keyword arguments as dictionary. The dictionary is created the first
+ * time this function is called and then reused.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param view:
+ *     An initialized view.
+ * :param out_kwd:
+ *     A pointer to a variable where to write the dictionary. If there are no
+ *     keyword arguments, ``HPy_NULL`` will be written. The handle is owned by
+ *     the view and must not be closed. The pointer will not be used if any
+ *     error occurs.
+ *
+ * :returns: ``0`` on failure, ``1`` on success.
+ */
+HPyAPI_HELPER int
+HPyKwargsView_AsDict(HPyContext *ctx, HPyKwargsView *view, HPy *out_kwd)
+{
+    if (view->_nkw > 0 && HPy_IsNull(view->_dict)) {
+        view->_dict = build_kwargs_dict(ctx, view->_values, view->_kwnames,
+                                        view->_nkw);
+        if (HPy_IsNull(view->_dict)) {
+            return 0;
+        }
+    }
+    *out_kwd = view->_dict;
+    return 1;
+}
+
+/**
+ * Release the resources of the view, i.e. the dictionary if one was created
+ * by :c:func:`HPyKwargsView_AsDict`.
+ */
+HPyAPI_HELPER void
+HPyKwargsView_Close(HPyContext *ctx, HPyKwargsView *view)
+{
+    HPy_Close(ctx, view->_dict);
+    view->_dict = HPy_NULL;
+}
@@ -130,6 +130,11 @@ HPyStructSequence_NewType(HPyContext *ctx, HPyStructSequence_Desc *desc)
     if (HPy_SetAttr_s(ctx, result, "n_fields", n_fields) < 0) {
         goto error;
     }
+    /* mark the type so that HPyStructSequence_New may fill its instances
+       directly (see ctx_StructSequence_New) */
+    if (HPy_SetAttr_s(ctx, result, "_hpy_structseq", ctx->h_True) < 0) {
+        goto error;
+    }
 
     /* Set the type name and qualname */
     s = strrchr(desc->name, '.');
@@ -201,27 +206,29 @@ HPyStructSequence_NewType(HPyContext *ctx, HPyStructSequence_Desc *desc)
 HPyAPI_HELPER HPy
 HPyStructSequence_New(HPyContext *ctx, HPy type, HPy_ssize_t nargs, HPy *args)
 {
-    static const char *s_n_fields = "n_fields";
 #ifndef HPY_ABI_CPYTHON
-    if (!HPy_HasAttr_s(ctx, type, s_n_fields)) {
-        HPyErr_Clear(ctx);
-        HPyErr_Format(ctx, ctx->h_TypeError,
-                "object '%R' does not look like a struct sequence type ", type);
-        return HPy_NULL;
-    }
-    HPy tuple = HPyTuple_FromArray(ctx, args, nargs);
-    if (HPy_IsNull(tuple)) {
-        return HPy_NULL;
-    }
-    HPy result = HPy_CallTupleDict(ctx, type, tuple, HPy_NULL);
-    HPy_Close(ctx, tuple);
-    return result;
+    /* the context reads the field count stored by HPyStructSequence_NewType
+       and fills the new object directly. _HPyStructSequence_New was added in
+       HPy ABI version 0.1: since HPY_ABI_VERSION_MINOR is at least 1, older
+       runtimes refuse to load the module instead of calling a missing
+       context member. */
+    return _HPyStructSequence_New(ctx, type, nargs, args);
 #else
+    static const char *s_n_fields = "n_fields";
     PyTypeObject *tp;
     PyObject *name, *v, *seq, *item;
     Py_ssize_t n_fields, i;
 
+    if (!PyType_Check(_h2py(type))) {
+        PyErr_Format(PyExc_TypeError,
+                     "object '%R' does not look like a struct sequence type",
+                     _h2py(type));
+        return HPy_NULL;
+    }
     tp = (PyTypeObject *)_h2py(type);
+    if (!PyType_IsSubtype(tp, &PyTuple_Type)) {
+        goto type_error;
+    }
     name = PyUnicode_FromStringAndSize(s_n_fields, sizeof(s_n_fields));
     // CPython also accesses the dict directly
 #if PY_VERSION_HEX >= 0x030C0000
@@ -244,7 +251,7 @@ HPyStructSequence_New(HPyContext *ctx, HPy type, HPy_ssize_t nargs, HPy *args)
     }
     if (n_fields != nargs) {
         PyErr_Format(PyExc_TypeError,
-                     "expected exactly %d arguments but got %d",
+                     "expected exactly %zd arguments but got %zd",
                      n_fields, nargs);
         Py_DECREF(seq);
         goto error;
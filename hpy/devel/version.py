@@ -0,0 +1,4 @@
+
+# automatically generated by setup.py:get_scm_config()
+__version__ = "0.9.0"
+__git_revision__ = "f075048"
@@ -20,8 +20,10 @@ typedef int HPyField;
 typedef int HPyGlobal;
 typedef int HPyListBuilder;
 typedef int HPyTupleBuilder;
+typedef int HPyDictBuilder;
 typedef int HPyTracker;
 typedef int HPy_RichCmpOp;
+typedef int HPySendResult;
 typedef int HPy_buffer;
 typedef int HPyFunc_visitproc;
 typedef int HPy_UCS4;
@@ -36,5 +38,6 @@ typedef int uint64_t;
 typedef int bool;
 typedef int HPy_SourceKind;
 typedef int HPyCallFunction;
+typedef int HPyCallSite;
 
 #include "public_api.h"
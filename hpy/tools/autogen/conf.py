@@ -4,6 +4,12 @@
 NO_TRAMPOLINES = {
     '_HPy_New',
     'HPy_FatalError',
+    '_HPyField_WriteBarrier',
+}
+
+# Optional context members: they are NULL in the universal context
+OPTIONAL_CTX_FUNCTIONS = {
+    '_HPyField_WriteBarrier',
 }
 
 # Generated trampoline returns given constant,
@@ -20,8 +26,13 @@ RETURN_CONSTANT = {
 SPECIAL_CASES = {
     'HPy_Dup': None,
     'HPy_Close': None,
+    'HPy_DupMany': None,
+    'HPy_CloseMany': None,
     'HPyField_Load': None,
     'HPyField_Store': None,
+    'HPyField_LoadMany': None,
+    'HPyField_StoreMany': None,
+    '_HPyField_WriteBarrier': None,
     'HPyModule_Create': None,
     'HPy_GetAttr': 'PyObject_GetAttr',
     'HPy_GetAttr_s': 'PyObject_GetAttrString',
@@ -47,6 +58,13 @@ SPECIAL_CASES = {
     'HPy_CallTupleDict': None,
     'HPy_Call': None, # 'PyObject_Vectorcall', no auto arg conversion
     'HPy_CallMethod': None, # 'PyObject_VectorcallMethod',no auto arg conversion
+    'HPy_CallMethodCached': None,
+    'HPyIter_NextBatch': None,
+    'HPy_GetBuffer': None,
+    'HPyBuffer_Release': None,
+    'HPyBuffer_IsContiguous': None,
+    'HPyBuffer_ToContiguous': None,
+    'HPyDict_Next': None,
     'HPy_FromPyObject': None,
     'HPy_AsPyObject': None,
     '_HPy_AsStruct_Object': None,
@@ -98,6 +116,7 @@ SPECIAL_CASES = {
     'HPy_InPlaceXor': 'PyNumber_InPlaceXor',
     'HPy_InPlaceOr': 'PyNumber_InPlaceOr',
     '_HPy_New': None,
+    '_HPyStructSequence_New': None,
     'HPyType_FromSpec': None,
     'HPyType_GenericNew': None,
     'HPy_Repr': 'PyObject_Repr',
@@ -119,6 +138,11 @@ SPECIAL_CASES = {
     'HPyTupleBuilder_Set': None,
     'HPyTupleBuilder_Build': None,
     'HPyTupleBuilder_Cancel': None,
+    'HPyDictBuilder_New': None,
+    'HPyDictBuilder_Set': None,
+    'HPyDictBuilder_Set_s': None,
+    'HPyDictBuilder_Build': None,
+    'HPyDictBuilder_Cancel': None,
     'HPyTracker_New': None,
     'HPyTracker_Add': None,
     'HPyTracker_ForgetAll': None,
@@ -188,6 +212,11 @@ DOC_MANUAL_API_MAPPING = {
     'PyObject_Type': 'HPy_Type',
     'PyObject_Vectorcall': 'HPy_Call',
     'PyObject_VectorcallMethod': 'HPy_CallMethod',
+    'PyObject_GetBuffer': 'HPy_GetBuffer',
+    'PyDict_Next': 'HPyDict_Next',
+    'PyBuffer_Release': 'HPyBuffer_Release',
+    'PyBuffer_IsContiguous': 'HPyBuffer_IsContiguous',
+    'PyBuffer_ToContiguous': 'HPyBuffer_ToContiguous',
 }
 
 # Some C API functions are documented in very different pages.
@@ -199,6 +228,7 @@ DOC_C_API_PAGES_SPECIAL_CASES = {
     'PyObject_Call': 'call',
     'PyObject_Vectorcall': 'call',
     'PyObject_VectorcallMethod': 'call',
+    'PyObject_GetBuffer': 'buffer',
 }
 
 # We assume that, e.g., prefix 'PyLong_Something' belongs to 'longobject.c' and
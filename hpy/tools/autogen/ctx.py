@@ -2,6 +2,7 @@ from copy import deepcopy
 from pycparser import c_ast
 from .autogenfile import AutoGenFile
 from .parse import toC, find_typedecl, maybe_make_void
+from . import conf
 
 
 class autogen_ctx_h(AutoGenFile):
@@ -79,7 +80,10 @@ class autogen_ctx_def_h(AutoGenFile):
         w('    .abi_version = HPY_ABI_VERSION,')
         w('    /* h_None & co. are initialized by init_universal_ctx() */')
         for func in self.api.functions:
-            w('    .%s = &%s,' % (func.ctx_name(), func.ctx_name()))
+            if func.name in conf.OPTIONAL_CTX_FUNCTIONS:
+                w('    .%s = NULL,' % func.ctx_name())
+            else:
+                w('    .%s = &%s,' % (func.ctx_name(), func.ctx_name()))
         w('};')
         return '\n'.join(lines)
 
@@ -62,9 +62,15 @@ class autogen_debug_wrappers(AutoGenFile):
     NO_WRAPPER = {
         '_HPy_CallRealFunctionFromTrampoline',
         'HPy_Close',
+        'HPy_CloseMany',
+        'HPy_DupMany',
+        'HPyField_StoreMany',
+        'HPyField_LoadMany',
+        '_HPyField_WriteBarrier',
         'HPyUnicode_AsUTF8AndSize',
         'HPyTuple_FromArray',
         'HPyType_GenericNew',
+        '_HPyStructSequence_New',
         'HPyType_FromSpec',
         '_HPy_AsStruct_Legacy',
         '_HPy_AsStruct_Object',
@@ -89,6 +95,11 @@ class autogen_debug_wrappers(AutoGenFile):
         'HPyListBuilder_Set',
         'HPyListBuilder_Build',
         'HPyListBuilder_Cancel',
+        'HPyDictBuilder_New',
+        'HPyDictBuilder_Set',
+        'HPyDictBuilder_Set_s',
+        'HPyDictBuilder_Build',
+        'HPyDictBuilder_Cancel',
         'HPy_TypeCheck',
         'HPyContextVar_Get',
         'HPyType_GetName',
@@ -96,6 +107,11 @@ class autogen_debug_wrappers(AutoGenFile):
         'HPyUnicode_Substring',
         'HPy_Call',
         'HPy_CallMethod',
+        'HPy_CallMethodCached',
+        'HPyIter_NextBatch',
+        'HPy_GetBuffer',
+        'HPyBuffer_Release',
+        'HPyDict_Next',
     }
 
     def generate(self):
@@ -5,7 +5,8 @@ from .parse import toC, find_typedecl
 
 NO_CALL = ('VARARGS', 'KEYWORDS', 'INITPROC', 'DESTROYFUNC',
            'GETBUFFERPROC', 'RELEASEBUFFERPROC', 'TRAVERSEPROC', 'MOD_CREATE',
-           'VECTORCALLFUNC', 'NEWFUNC')
+           'VECTORCALLFUNC', 'NEWFUNC', 'KWTABLE', 'ITERNEXTBATCHFUNC',
+           'SENDFUNC')
 NO_TRAMPOLINE = NO_CALL + ('RICHCMPFUNC',)
 
 # This is a list of type that can automatically be converted from Python to HPy
@@ -92,8 +93,7 @@ class autogen_hpyfunc_trampoline_h(AutoGenFile):
             w(f'    static {toC(tramp_node)} \\')
             w(f'    {{ \\')
             w(f'        _HPyFunc_args_{NAME} a = {{ {arg_names} }}; \\')
-            w(f'        _HPy_CallRealFunctionFromTrampoline( \\')
-            w(f'           _ctx_for_trampolines, HPyFunc_{NAME}, (HPyCFunction)IMPL, &a); \\')
+            w(f'        _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_{NAME}, IMPL, &a); \\')
             if toC(tramp_node.type) == 'void':
                 w(f'        return; \\')
             else:
@@ -122,14 +122,22 @@ def _h2py(type):
 class autogen_ctx_call_i(AutoGenFile):
     PATH = 'hpy/universal/src/autogen_ctx_call.i'
 
+    ## static void
+    ## call_NOARGS(HPyContext *ctx, HPyCFunction func, void *args)
+    ## { ... }
+    ##
+    ## #define _HPY_AUTOGEN_CALL_SIGNATURES(X) X(NOARGS) ...
+
     def generate(self):
         lines = []
         w = lines.append
+        names = []
         for hpyfunc in self.api.hpyfunc_typedefs:
             name = hpyfunc.base_name()
             NAME = name.upper()
             if NAME in NO_CALL:
                 continue
+            names.append(NAME)
             #
             c_ret_type = toC(hpyfunc.return_type())
             args = ['ctx']
@@ -140,15 +148,23 @@ class autogen_ctx_call_i(AutoGenFile):
                 args.append(f'{_py2h(toC(param.type))}(a->{pname})')
             args = ', '.join(args)
             #
-            w(f'    case HPyFunc_{NAME}: {{')
-            w(f'        HPyFunc_{name} f = (HPyFunc_{name})func;')
-            w(f'        _HPyFunc_args_{NAME} *a = (_HPyFunc_args_{NAME}*)args;')
+            w(f'static void')
+            w(f'call_{NAME}(HPyContext *ctx, HPyCFunction func, void *args)')
+            w(f'{{')
+            w(f'    HPyFunc_{name} f = (HPyFunc_{name})func;')
+            w(f'    _HPyFunc_args_{NAME} *a = (_HPyFunc_args_{NAME}*)args;')
             if c_ret_type == 'void':
-                w(f'        f({args});')
+                w(f'    f({args});')
             else:
-                w(f'        a->result = {_h2py(c_ret_type)}(f({args}));')
-            w(f'        return;')
-            w(f'    }}')
+                w(f'    a->result = {_h2py(c_ret_type)}(f({args}));')
+            w(f'}}')
+            w('')
+        #
+        # the list of signatures implemented above, as an X-macro
+        w('#define _HPY_AUTOGEN_CALL_SIGNATURES(X) \\')
+        for NAME in names:
+            w(f'    X({NAME}) \\')
+        w('    /* end */')
         return '\n'.join(lines)
 
 
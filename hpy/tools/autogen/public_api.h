@@ -113,6 +113,39 @@ HPy HPy_Dup(HPyContext *ctx, HPy h);
 HPy_ID(78)
 void HPy_Close(HPyContext *ctx, HPy h);
 
+/**
+ * Close ``n`` handles at once. This is equivalent to calling ``HPy_Close`` on
+ * each of them, but it needs only one call into the context.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param hs:
+ *     An array of ``n`` handles. Like for ``HPy_Close``, any of them may be
+ *     ``HPy_NULL``. The handles must not be used after this call.
+ * :param n:
+ *     The number of handles in ``hs``.
+ */
+HPy_ID(273)
+void HPy_CloseMany(HPyContext *ctx, const HPy *hs, HPy_ssize_t n);
+
+/**
+ * Duplicate ``n`` handles at once. This is equivalent to
+ * ``out[i] = HPy_Dup(ctx, hs[i])`` for each ``i``, but it needs only one call
+ * into the context.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param hs:
+ *     An array of ``n`` handles. Any of them may be ``HPy_NULL``.
+ * :param out:
+ *     An array of (at least) ``n`` handles which receives the new handles. It
+ *     may be the same array as ``hs``.
+ * :param n:
+ *     The number of handles in ``hs``.
+ */
+HPy_ID(274)
+void HPy_DupMany(HPyContext *ctx, const HPy *hs, HPy *out, HPy_ssize_t n);
+
 HPy_ID(79)
 HPy HPyLong_FromInt32_t(HPyContext *ctx, int32_t value);
 HPy_ID(80)
@@ -307,6 +340,38 @@ HPy HPy_Call(HPyContext *ctx, HPy callable, const HPy *args, size_t nargs, HPy k
 HPy_ID(262)
 HPy HPy_CallMethod(HPyContext *ctx, HPy name, const HPy *args, size_t nargs, HPy kwnames);
 
+/**
+ * Call a method of a Python object through a call site. This is like
+ * :c:func:`HPy_CallMethod` but the method name and the keyword argument names
+ * are given as C strings in ``site`` and converted only once. Moreover, the
+ * site caches the method found for the type of the receiver, such that
+ * repeated calls on objects of the same type skip the method lookup as long
+ * as the type is not modified.
+ *
+ * The cache only holds one type, so it is most effective for monomorphic call
+ * sites. It is not used for receivers which have an instance ``__dict__`` or
+ * a custom attribute lookup, nor if the method is not a plain function or
+ * method descriptor; these calls just do the normal method lookup.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param site:
+ *     The call site; see :c:type:`HPyCallSite`.
+ * :param args:
+ *     A pointer to an array of the arguments. The receiver is ``args[0]``,
+ *     followed by the positional arguments and then by one value for each
+ *     name in ``site->kwnames``.
+ * :param nargs:
+ *     The number of positional arguments in ``args`` including the receiver
+ *     at ``args[0]`` (therefore, ``nargs`` must be at least ``1``). It does
+ *     not include the keyword arguments.
+ *
+ * :returns:
+ *     The result of the call on success, or ``HPy_NULL`` in case of an error.
+ */
+HPy_ID(279)
+HPy HPy_CallMethodCached(HPyContext *ctx, HPyCallSite *site, const HPy *args, size_t nargs);
+
 /**
  * Return a new iterator for iterable object ``obj``. This is the equivalent
  * of the Python expression ``iter(obj)``.
@@ -356,6 +421,29 @@ HPy HPyIter_Next(HPyContext *ctx, HPy obj);
 HPy_ID(271)
 int HPyIter_Check(HPyContext *ctx, HPy obj);
 
+/**
+ * Get up to ``n`` values from iterator ``obj`` at once. If the type of the
+ * iterator defines slot ``HPy_tp_iternext_batch``, it is called directly;
+ * otherwise, this is equivalent to calling :c:func:`HPyIter_Next` in a loop.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param obj:
+ *     An iterator Python object (must not be ``HPy_NULL``).
+ * :param items:
+ *     An array of at least ``n`` elements where the new handles to the
+ *     values are stored. The caller must close them.
+ * :param n:
+ *     The maximum number of values to get.
+ *
+ * :returns:
+ *     The number of values stored in ``items``, which is ``0`` if the
+ *     iterator is exhausted, or ``-1`` in case of an error. Fewer than ``n``
+ *     values do not necessarily mean that the iterator is exhausted.
+ */
+HPy_ID(280)
+HPy_ssize_t HPyIter_NextBatch(HPyContext *ctx, HPy obj, HPy *items, HPy_ssize_t n);
+
 /* pyerrors.h */
 HPy_ID(136)
 void HPy_FatalError(HPyContext *ctx, const char *message);
@@ -663,6 +751,12 @@ HPyType_BuiltinShape _HPyType_GetBuiltinShape(HPyContext *ctx, HPy h_type);
 HPy_ID(170)
 HPy _HPy_New(HPyContext *ctx, HPy h_type, void **data);
 
+/* Create an instance of a struct sequence type created by
+   HPyStructSequence_NewType; used to implement HPyStructSequence_New in the
+   universal ABI. */
+HPy_ID(275)
+HPy _HPyStructSequence_New(HPyContext *ctx, HPy type, HPy_ssize_t nargs, const HPy *args);
+
 HPy_ID(171)
 HPy HPy_Repr(HPyContext *ctx, HPy obj);
 HPy_ID(172)
@@ -680,6 +774,83 @@ int HPy_RichCompareBool(HPyContext *ctx, HPy v, HPy w, int op);
 HPy_ID(177)
 HPy_hash_t HPy_Hash(HPyContext *ctx, HPy obj);
 
+/* abstract.h: buffer protocol */
+
+/**
+ * Get a view on the memory exported by ``obj``, without copying it. This is
+ * the equivalent of CPython's ``PyObject_GetBuffer``.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param obj:
+ *     The exporting object (e.g. a ``bytes``, ``bytearray``, ``memoryview``
+ *     or NumPy array).
+ * :param view:
+ *     The view to fill. On success, ``view->obj`` is a new handle which is
+ *     closed by :c:func:`HPyBuffer_Release`.
+ * :param flags:
+ *     A combination of the ``HPyBUF_*`` flags describing what the caller can
+ *     handle, e.g. ``HPyBUF_SIMPLE`` or ``HPyBUF_RECORDS_RO``.
+ *
+ * :returns:
+ *     ``0`` on success, ``-1`` with an exception set (usually ``TypeError``
+ *     or ``BufferError``) otherwise.
+ */
+HPy_ID(281)
+int HPy_GetBuffer(HPyContext *ctx, HPy obj, HPy_buffer *view, int flags);
+
+/**
+ * Release a view obtained with :c:func:`HPy_GetBuffer`. The view must be
+ * released exactly once, and its memory must not be accessed afterwards.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param view:
+ *     The view to release.
+ */
+HPy_ID(282)
+void HPyBuffer_Release(HPyContext *ctx, HPy_buffer *view);
+
+/**
+ * Check whether the memory of a view is contiguous.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param view:
+ *     The view to check.
+ * :param order:
+ *     ``'C'`` (row-major), ``'F'`` (column-major) or ``'A'`` (either).
+ *
+ * :returns:
+ *     ``1`` if the memory of ``view`` is contiguous in the given order, ``0``
+ *     otherwise.
+ */
+HPy_ID(283)
+int HPyBuffer_IsContiguous(HPyContext *ctx, const HPy_buffer *view, char order);
+
+/**
+ * Copy the memory of a view into the contiguous buffer ``buf``. Together with
+ * :c:func:`HPyBuffer_IsContiguous`, this can be used to read a view in place
+ * when it is contiguous and to copy it only when it is not.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param buf:
+ *     The destination, of at least ``len`` bytes.
+ * :param view:
+ *     The view to copy.
+ * :param len:
+ *     Must be equal to ``view->len``.
+ * :param order:
+ *     ``'C'``, ``'F'`` or ``'A'``: the layout of the copy.
+ *
+ * :returns:
+ *     ``0`` on success, ``-1`` with an exception set otherwise.
+ */
+HPy_ID(284)
+int HPyBuffer_ToContiguous(HPyContext *ctx, void *buf, const HPy_buffer *view,
+                           HPy_ssize_t len, char order);
+
 /* bytesobject.h */
 HPy_ID(178)
 int HPyBytes_Check(HPyContext *ctx, HPy h);
@@ -919,6 +1090,45 @@ HPy HPyDict_Keys(HPyContext *ctx, HPy h);
 HPy_ID(258)
 HPy HPyDict_Copy(HPyContext *ctx, HPy h);
 
+/**
+ * Iterates over the key-value pairs of a dictionary, without creating a list
+ * of the keys and without looking up the value of each key. This is the
+ * equivalent of CPython's ``PyDict_Next``, except that the returned handles
+ * are new handles which must be closed::
+ *
+ *     HPy_ssize_t pos = 0;
+ *     HPy key, value;
+ *     int res;
+ *     while ((res = HPyDict_Next(ctx, h, &pos, &key, &value)) > 0) {
+ *         ...
+ *         HPy_Close(ctx, key);
+ *         HPy_Close(ctx, value);
+ *     }
+ *     if (res < 0)
+ *         return HPy_NULL;
+ *
+ * The dictionary must not be modified during the iteration.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param h:
+ *     A Python dict object. If this argument is ``HPy_NULL`` or not an
+ *     instance of a Python dict, a ``SystemError`` will be raised.
+ * :param pos:
+ *     The position of the iteration, which must be initialized to ``0``
+ *     before the first call. Its value is otherwise opaque.
+ * :param key:
+ *     Where to store a new handle to the next key; may be ``NULL``.
+ * :param value:
+ *     Where to store a new handle to the next value; may be ``NULL``.
+ *
+ * :returns:
+ *     ``1`` if a pair was stored, ``0`` if there are no more pairs or ``-1``
+ *     in case of an error.
+ */
+HPy_ID(285)
+int HPyDict_Next(HPyContext *ctx, HPy h, HPy_ssize_t *pos, HPy *key, HPy *value);
+
 /* tupleobject.h */
 
 /**
@@ -1166,6 +1376,99 @@ HPy HPyTupleBuilder_Build(HPyContext *ctx, HPyTupleBuilder builder);
 HPy_ID(216)
 void HPyTupleBuilder_Cancel(HPyContext *ctx, HPyTupleBuilder builder);
 
+/**
+ * Create a new dict builder for about ``size`` items: where the Python
+ * implementation supports it (e.g. CPython before 3.13), the hash table of
+ * the dict is allocated upfront, so that it is not resized while the items
+ * are inserted. Like :c:func:`HPyTupleBuilder_New`, this function does not raise
+ * any exception (even if running out of memory): the error is reported by
+ * :c:func:`HPyDictBuilder_Build`.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param size:
+ *     The expected number of items. More items can be inserted, at the cost
+ *     of resizing the dict.
+ */
+HPy_ID(286)
+HPyDictBuilder HPyDictBuilder_New(HPyContext *ctx, HPy_ssize_t size);
+
+/**
+ * Insert an item into the builder. If the key was already inserted, its value
+ * is replaced.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param builder:
+ *     A dict builder handle.
+ * :param h_key:
+ *     An HPy handle of the key, which must be hashable. Please note that HPy
+ *     **never** steals handles and so, ``h_key`` and ``h_value`` need to be
+ *     closed by the caller.
+ * :param h_value:
+ *     An HPy handle of the value.
+ *
+ * :returns:
+ *     ``0`` on success, ``-1`` with an exception set if the key cannot be
+ *     hashed or compared. The builder must then be cancelled.
+ */
+HPy_ID(287)
+int HPyDictBuilder_Set(HPyContext *ctx, HPyDictBuilder builder,
+                       HPy h_key, HPy h_value);
+
+/**
+ * Insert an item with a string key into the builder. This is the same as
+ * :c:func:`HPyDictBuilder_Set` with ``HPyUnicode_FromString(ctx, utf8_key)``
+ * as key, but the key is created and inserted in a single call, without
+ * creating a handle for it. This is meant for the common case of dicts with
+ * known, unique string keys (e.g. the fields of a record).
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param builder:
+ *     A dict builder handle.
+ * :param utf8_key:
+ *     The key as a UTF-8 encoded C string.
+ * :param h_value:
+ *     An HPy handle of the value.
+ *
+ * :returns:
+ *     ``0`` on success, ``-1`` with an exception set otherwise. The builder
+ *     must then be cancelled.
+ */
+HPy_ID(288)
+int HPyDictBuilder_Set_s(HPyContext *ctx, HPyDictBuilder builder,
+                         const char *utf8_key, HPy h_value);
+
+/**
+ * Build a dict from a dict builder.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param builder:
+ *     A dict builder handle.
+ *
+ * :returns:
+ *     An HPy handle to a dict containing the items inserted with
+ *     :c:func:`HPyDictBuilder_Set` or ``HPy_NULL`` in case an error occurred
+ *     when creating the builder.
+ */
+HPy_ID(289)
+HPy HPyDictBuilder_Build(HPyContext *ctx, HPyDictBuilder builder);
+
+/**
+ * Cancel building of a dict and free any acquired resources.
+ * This function ignores if any error occurred previously when using the dict
+ * builder.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param builder:
+ *     A dict builder handle.
+ */
+HPy_ID(290)
+void HPyDictBuilder_Cancel(HPyContext *ctx, HPyDictBuilder builder);
+
 /* Helper for correctly closing handles */
 
 HPy_ID(217)
@@ -1214,6 +1517,65 @@ void HPyField_Store(HPyContext *ctx, HPy target_object, HPyField *target_field,
 HPy_ID(222)
 HPy HPyField_Load(HPyContext *ctx, HPy source_object, HPyField source_field);
 
+/**
+ * Store ``n`` handles into ``n`` fields of the same object in one call.
+ *
+ * This is equivalent to calling ``HPyField_Store(ctx, target_object,
+ * target_fields[i], hs[i])`` for each ``i``, but implementations which need a
+ * write barrier execute it only once for the whole batch.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param target_object:
+ *     The object which contains all the fields.
+ * :param target_fields:
+ *     An array of ``n`` pointers to the fields to overwrite.
+ * :param hs:
+ *     An array of ``n`` handles (may contain ``HPy_NULL``).
+ * :param n:
+ *     The number of fields.
+ */
+HPy_ID(276)
+void HPyField_StoreMany(HPyContext *ctx, HPy target_object,
+                        HPyField **target_fields, const HPy *hs,
+                        HPy_ssize_t n);
+
+/**
+ * Load ``n`` fields of the same object in one call.
+ *
+ * This is equivalent to ``out[i] = HPyField_Load(ctx, source_object,
+ * *source_fields[i])`` for each ``i``. The resulting handles are owned by the
+ * caller and must be closed, e.g. with :c:func:`HPy_CloseMany`.
+ *
+ * :param ctx:
+ *     The execution context.
+ * :param source_object:
+ *     The object which contains all the fields.
+ * :param source_fields:
+ *     An array of ``n`` pointers to the fields to read. The fields must not
+ *     be ``HPyField_NULL``.
+ * :param out:
+ *     An array of at least ``n`` elements which receives the new handles.
+ * :param n:
+ *     The number of fields.
+ */
+HPy_ID(277)
+void HPyField_LoadMany(HPyContext *ctx, HPy source_object,
+                       HPyField **source_fields, HPy *out, HPy_ssize_t n);
+
+/**
+ * Write barrier hook for implementations whose GC needs one, e.g. a
+ * generational GC which must remember the old objects which point to young
+ * ones.
+ *
+ * This context member may be ``NULL``, which is the case on CPython. If it
+ * is set, ``HPyField_Store`` and ``HPyField_StoreMany`` call it once per call,
+ * after the fields of ``target_object`` have been written. Extensions must
+ * not call it directly.
+ */
+HPy_ID(278)
+void _HPyField_WriteBarrier(HPyContext *ctx, HPy target_object);
+
 /**
  * Leaving Python execution: for releasing GIL and other use-cases.
  *
@@ -1398,6 +1760,8 @@ typedef HPy (*HPyFunc_o)(HPyContext *ctx, HPy self, HPy arg);
 typedef HPy (*HPyFunc_varargs)(HPyContext *ctx, HPy self, const HPy *args, size_t nargs);
 typedef HPy (*HPyFunc_keywords)(HPyContext *ctx, HPy self, const HPy *args,
                                 size_t nargs, HPy kwnames);
+typedef HPy (*HPyFunc_kwtable)(HPyContext *ctx, HPy self, const HPy *args,
+                               size_t nargs);
 
 typedef HPy (*HPyFunc_unaryfunc)(HPyContext *ctx, HPy);
 typedef HPy (*HPyFunc_binaryfunc)(HPyContext *ctx, HPy, HPy);
@@ -1438,6 +1802,12 @@ typedef void (*HPyFunc_destroyfunc)(void *);
 // Note: separate type, because we need a different trampoline
 typedef HPy (*HPyFunc_mod_create)(HPyContext *ctx, HPy);
 
+typedef HPy_ssize_t (*HPyFunc_iternextbatchfunc)(HPyContext *ctx, HPy self,
+                                                 HPy *items, HPy_ssize_t n);
+
+typedef HPySendResult (*HPyFunc_sendfunc)(HPyContext *ctx, HPy self, HPy value,
+                                          HPy *result);
+
 
 /* ~~~ HPySlot_Slot ~~~
 
@@ -1515,8 +1885,8 @@ typedef enum {
     HPy_tp_hash = SLOT(59, HPyFunc_HASHFUNC),
     HPy_tp_init = SLOT(60, HPyFunc_INITPROC),
     //HPy_tp_is_gc = SLOT(61, HPyFunc_X),
-    //HPy_tp_iter = SLOT(62, HPyFunc_X),
-    //HPy_tp_iternext = SLOT(63, HPyFunc_X),
+    HPy_tp_iter = SLOT(62, HPyFunc_GETITERFUNC),
+    HPy_tp_iternext = SLOT(63, HPyFunc_ITERNEXTFUNC),
     //HPy_tp_methods = SLOT(64, HPyFunc_X),    NOT SUPPORTED
     HPy_tp_new = SLOT(65, HPyFunc_NEWFUNC),
     HPy_tp_repr = SLOT(66, HPyFunc_REPRFUNC),
@@ -1530,14 +1900,33 @@ typedef enum {
     //HPy_tp_free = SLOT(74, HPyFunc_X),       NOT SUPPORTED
     HPy_nb_matrix_multiply = SLOT(75, HPyFunc_BINARYFUNC),
     HPy_nb_inplace_matrix_multiply = SLOT(76, HPyFunc_BINARYFUNC),
-    //HPy_am_await = SLOT(77, HPyFunc_X),
-    //HPy_am_aiter = SLOT(78, HPyFunc_X),
-    //HPy_am_anext = SLOT(79, HPyFunc_X),
+    HPy_am_await = SLOT(77, HPyFunc_UNARYFUNC),
+    HPy_am_aiter = SLOT(78, HPyFunc_UNARYFUNC),
+    HPy_am_anext = SLOT(79, HPyFunc_UNARYFUNC),
     HPy_tp_finalize = SLOT(80, HPyFunc_DESTRUCTOR),
+    /**
+     * Resume the awaitable or iterator with ``value`` without raising
+     * ``StopIteration``: the function stores the yielded (or returned) value
+     * in ``*result`` and returns ``HPySend_NEXT`` (or ``HPySend_RETURN``); in
+     * case of an error, it returns ``HPySend_ERROR``. This slot only exists
+     * since CPython 3.10 and is ignored on older versions, where the
+     * awaitable must be resumed through ``HPy_tp_iternext``.
+     */
+    HPy_am_send = SLOT(81, HPyFunc_SENDFUNC),
 
     /* extra HPy slots */
     HPy_tp_destroy = SLOT(1000, HPyFunc_DESTROYFUNC),
 
+    /**
+     * Optional companion of ``HPy_tp_iternext`` (which must also be defined)
+     * for the consumers which use :c:func:`HPyIter_NextBatch`: the function
+     * stores up to ``n`` new items in ``items`` and returns their number,
+     * ``0`` if the iterator is exhausted or ``-1`` in case of an error. It
+     * does not map to any CPython slot, so Python code still uses
+     * ``HPy_tp_iternext``.
+     */
+    HPy_tp_iternext_batch = SLOT(1001, HPyFunc_ITERNEXTBATCHFUNC),
+
     /**
      * Module create slot: the function receives loader spec and should
      * return an HPy handle representing the module. Currently, creating
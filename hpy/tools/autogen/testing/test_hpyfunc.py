@@ -49,8 +49,7 @@ class TestHPyFunc(BaseTestAutogen):
                 static cpy_PyObject *SYM(cpy_PyObject *arg, int xy) \
                 { \
                     _HPyFunc_args_FOO a = { arg, xy }; \
-                    _HPy_CallRealFunctionFromTrampoline( \
-                       _ctx_for_trampolines, HPyFunc_FOO, (HPyCFunction)IMPL, &a); \
+                    _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_FOO, IMPL, &a); \
                     return a.result; \
                 }
 
@@ -64,8 +63,7 @@ class TestHPyFunc(BaseTestAutogen):
                 static cpy_PyObject *SYM(cpy_PyObject *arg0, int arg1) \
                 { \
                     _HPyFunc_args_BAR a = { arg0, arg1 }; \
-                    _HPy_CallRealFunctionFromTrampoline( \
-                       _ctx_for_trampolines, HPyFunc_BAR, (HPyCFunction)IMPL, &a); \
+                    _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_BAR, IMPL, &a); \
                     return a.result; \
                 }
 
@@ -77,8 +75,7 @@ class TestHPyFunc(BaseTestAutogen):
                 static void SYM(int x) \
                 { \
                     _HPyFunc_args_PROC a = { x }; \
-                    _HPy_CallRealFunctionFromTrampoline( \
-                       _ctx_for_trampolines, HPyFunc_PROC, (HPyCFunction)IMPL, &a); \
+                    _HPyFunc_CALL_REAL_FUNCTION(HPyFunc_PROC, IMPL, &a); \
                     return; \
                 }
         """
@@ -93,30 +90,44 @@ class TestHPyFunc(BaseTestAutogen):
         """)
         got = autogen_ctx_call_i(api).generate()
         exp = r"""
-            case HPyFunc_FOO: {
+            static void
+            call_FOO(HPyContext *ctx, HPyCFunction func, void *args)
+            {
                 HPyFunc_foo f = (HPyFunc_foo)func;
                 _HPyFunc_args_FOO *a = (_HPyFunc_args_FOO*)args;
-                a->result = _h2py(f(ctx, _py2h(a->arg), a->xy));
-                return;
+                a->result = _h2py(f(ctx, _py2h(a->arg), (a->xy)));
             }
-            case HPyFunc_BAR: {
+
+            static void
+            call_BAR(HPyContext *ctx, HPyCFunction func, void *args)
+            {
                 HPyFunc_bar f = (HPyFunc_bar)func;
                 _HPyFunc_args_BAR *a = (_HPyFunc_args_BAR*)args;
-                a->result = f(ctx);
-                return;
+                a->result = (f(ctx));
             }
-            case HPyFunc_BAZ: {
+
+            static void
+            call_BAZ(HPyContext *ctx, HPyCFunction func, void *args)
+            {
                 HPyFunc_baz f = (HPyFunc_baz)func;
                 _HPyFunc_args_BAZ *a = (_HPyFunc_args_BAZ*)args;
-                a->result = f(ctx, _py2h(a->arg0), a->arg1);
-                return;
+                a->result = (f(ctx, _py2h(a->arg0), (a->arg1)));
             }
-            case HPyFunc_PROC: {
+
+            static void
+            call_PROC(HPyContext *ctx, HPyCFunction func, void *args)
+            {
                 HPyFunc_proc f = (HPyFunc_proc)func;
                 _HPyFunc_args_PROC *a = (_HPyFunc_args_PROC*)args;
-                f(ctx, a->x);
-                return;
+                f(ctx, (a->x));
             }
+
+            #define _HPY_AUTOGEN_CALL_SIGNATURES(X) \
+                X(FOO) \
+                X(BAR) \
+                X(BAZ) \
+                X(PROC) \
+                /* end */
         """
         assert src_equal(got, exp)
 
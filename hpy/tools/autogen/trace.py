@@ -11,6 +11,7 @@ from .parse import toC, find_typedecl, get_context_return_type, \
 NO_WRAPPER = {
     '_HPy_CallRealFunctionFromTrampoline',
     'HPy_FatalError',
+    '_HPyField_WriteBarrier',
 }
 
 class Ctx2TctxVisitor(c_ast.NodeVisitor):
@@ -47,12 +48,44 @@ class autogen_tracer_ctx_init_h(AutoGenFile):
                 w(toC(get_trace_wrapper_node(func)) + ';')
         n_decls = len(self.api.functions) + len(self.api.variables)
         w('')
+        w(f'static inline void trace_ctx_free_shard(HPyTraceShard *shard)')
+        w('{')
+        w(f'    free(shard->call_counts);')
+        w(f'    free(shard->durations);')
+        w(f'    free(shard->timed_counts);')
+        w(f'    free(shard->histograms);')
+        w(f'    free(shard->max_durations);')
+        w(f'    free(shard);')
+        w('}')
+        w('')
+        w(f'static inline HPyTraceShard *trace_ctx_new_shard(HPyTraceInfo *info)')
+        w('{')
+        w(f'    HPyTraceShard *shard = (HPyTraceShard *)malloc(sizeof(HPyTraceShard));')
+        w(f'    if (shard == NULL)')
+        w(f'        return NULL;')
+        w(f'    shard->info = info;')
+        w(f'    shard->next = NULL;')
+        w(f'    shard->call_counts = (uint64_t *)calloc({n_decls}, sizeof(uint64_t));')
+        w(f'    shard->durations = (_HPyTime_t *)calloc({n_decls}, sizeof(_HPyTime_t));')
+        w(f'    shard->timed_counts = (uint64_t *)calloc({n_decls}, sizeof(uint64_t));')
+        w(f'    shard->histograms = (uint64_t *)calloc({n_decls} * HPY_TRACE_HIST_NBUCKETS,')
+        w(f'                                           sizeof(uint64_t));')
+        w(f'    shard->max_durations = (uint64_t *)calloc({n_decls}, sizeof(uint64_t));')
+        w(f'    if (shard->call_counts == NULL || shard->durations == NULL ||')
+        w(f'            shard->timed_counts == NULL || shard->histograms == NULL ||')
+        w(f'            shard->max_durations == NULL) {{')
+        w(f'        trace_ctx_free_shard(shard);')
+        w(f'        return NULL;')
+        w(f'    }}')
+        w(f'    return shard;')
+        w('}')
+        w('')
         w(f'static inline void trace_ctx_init_info(HPyTraceInfo *info, HPyContext *uctx)')
         w('{')
         w(f'    info->magic_number = HPY_TRACE_MAGIC;')
         w(f'    info->uctx = uctx;')
-        w(f'    info->call_counts = (uint64_t *)calloc({n_decls}, sizeof(uint64_t));')
-        w(f'    info->durations = (_HPyTime_t *)calloc({n_decls}, sizeof(_HPyTime_t));')
+        w(f'    info->shards = NULL;')
+        w(f'    info->sample_period = 1;')
         w(f'    info->on_enter_func = HPy_NULL;')
         w(f'    info->on_exit_func = HPy_NULL;')
         w('}')
@@ -60,8 +93,12 @@ class autogen_tracer_ctx_init_h(AutoGenFile):
         w(f'static inline void trace_ctx_free_info(HPyTraceInfo *info)')
         w('{')
         w(f'    assert(info->magic_number == HPY_TRACE_MAGIC);')
-        w(f'    free(info->call_counts);')
-        w(f'    free(info->durations);')
+        w(f'    HPyTraceShard *shard = info->shards;')
+        w(f'    while (shard != NULL) {{')
+        w(f'        HPyTraceShard *next = shard->next;')
+        w(f'        trace_ctx_free_shard(shard);')
+        w(f'        shard = next;')
+        w(f'    }}')
         w(f'    HPy_Close(info->uctx, info->on_enter_func);')
         w(f'    HPy_Close(info->uctx, info->on_exit_func);')
         w('}')
@@ -123,17 +160,20 @@ class autogen_tracer_wrappers(AutoGenFile):
         w = lines.append
         w(signature)
         w('{')
-        w(f'    HPyTraceInfo *info = hpy_trace_on_enter(tctx, {func.ctx_index});')
-        w(f'    HPyContext *uctx = info->uctx;')
+        w(f'    HPyTraceShard *shard = hpy_trace_on_enter(tctx, {func.ctx_index});')
+        w(f'    HPyContext *uctx = shard->info->uctx;')
         w(f'    _HPyTime_t _ts_start, _ts_end;')
-        w(f'    _HPyClockStatus_t r0, r1;')
-        w(f'    r0 = get_monotonic_clock(&_ts_start);')
+        w(f'    _HPyClockStatus_t r0 = 0, r1 = 0;')
+        w(f'    bool timed = hpy_trace_should_time(shard, {func.ctx_index});')
+        w(f'    if (timed)')
+        w(f'        r0 = get_monotonic_clock(&_ts_start);')
         if rettype == 'void':
             w(f'    {func.name}({params});')
         else:
             w(f'    {rettype} res = {func.name}({params});')
-        w(f'    r1 = get_monotonic_clock(&_ts_end);')
-        w(f'    hpy_trace_on_exit(info, {func.ctx_index}, r0, r1, &_ts_start, &_ts_end);')
+        w(f'    if (timed)')
+        w(f'        r1 = get_monotonic_clock(&_ts_end);')
+        w(f'    hpy_trace_on_exit(shard, {func.ctx_index}, timed, r0, r1, &_ts_start, &_ts_end);')
         if rettype != 'void':
             w(f'    return res;')
         w('}')
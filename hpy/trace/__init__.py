@@ -1,6 +1,101 @@
-import hpy.universal
+from collections import namedtuple
 
-get_call_counts = hpy.universal._trace.get_call_counts
-get_durations = hpy.universal._trace.get_durations
-set_trace_functions = hpy.universal._trace.set_trace_functions
-get_frequency = hpy.universal._trace.get_frequency
+# hpy.universal is imported lazily, so that the submodules which do not
+# need it (e.g. hpy.trace.events) can be used without it
+_TRACE_FUNCTIONS = frozenset([
+    'get_call_counts',
+    'get_durations',
+    'get_call_counts_by_module',
+    'get_durations_by_module',
+    'get_timed_call_counts',
+    'get_max_durations',
+    'get_histograms',
+    'get_histogram_bounds',
+    'get_sample_period',
+    'set_sample_period',
+    'set_trace_functions',
+    'get_frequency',
+    'get_event_buffer_size',
+    'set_event_buffer_size',
+    'dump_events',
+])
+
+
+def _trace():
+    import hpy.universal
+    return hpy.universal._trace
+
+
+def __getattr__(name):
+    if name in _TRACE_FUNCTIONS:
+        return getattr(_trace(), name)
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+
+def get_estimated_durations():
+    """
+    Like get_durations() but, in sampling mode, extrapolate the durations of
+    the timed calls to all calls of each function.
+    """
+    durations = _trace().get_durations()
+    counts = _trace().get_call_counts()
+    timed = _trace().get_timed_call_counts()
+    res = {}
+    for name, duration in durations.items():
+        n_timed = timed[name]
+        if n_timed == 0 or n_timed == counts[name]:
+            res[name] = duration
+        else:
+            res[name] = duration * counts[name] // n_timed
+    return res
+
+
+def histogram_percentile(counts, p, max_ns=None, bounds=None):
+    """
+    Estimate the p-th percentile (0 < p <= 100) of the durations counted in
+    'counts', which is a histogram as returned by get_histograms(). The
+    result is the upper bound of the bucket which contains the percentile,
+    so it overestimates the exact value by at most the width of the bucket.
+    If given, 'max_ns' caps the result. Return None if 'counts' is empty.
+    """
+    if bounds is None:
+        bounds = _trace().get_histogram_bounds()
+    total = sum(counts)
+    if total == 0:
+        return None
+    # the rank of the percentile, i.e. ceil(p * total / 100)
+    rank = max(1, -(-p * total // 100))
+    cumulative = 0
+    for b, n in enumerate(counts):
+        cumulative += n
+        if cumulative >= rank:
+            break
+    if b + 1 < len(bounds):
+        res = bounds[b + 1] - 1
+        return res if max_ns is None else min(res, max_ns)
+    # the last bucket has no upper bound
+    return max_ns if max_ns is not None else bounds[b]
+
+
+LatencyStats = namedtuple('LatencyStats', ['func', 'count', 'p50_ns',
+                                           'p99_ns', 'max_ns'])
+
+
+def get_latency_stats():
+    """
+    Return a LatencyStats for each HPy API function which has been timed,
+    sorted by decreasing 99th percentile, i.e. the worst tail latencies
+    first. Only the timed calls are included, see set_sample_period().
+    """
+    bounds = _trace().get_histogram_bounds()
+    max_durations = _trace().get_max_durations()
+    res = []
+    for name, counts in _trace().get_histograms().items():
+        max_ns = max_durations[name]
+        res.append(LatencyStats(
+            name, sum(counts),
+            histogram_percentile(counts, 50, max_ns, bounds),
+            histogram_percentile(counts, 99, max_ns, bounds),
+            max_ns))
+    res.sort(key=lambda s: (s.p99_ns, s.max_ns), reverse=True)
+    return res
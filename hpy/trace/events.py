@@ -0,0 +1,164 @@
+"""
+Reader for the event files written by hpy.trace.dump_events().
+
+The file starts with a fixed-size header followed by an array of fixed-size
+events, so that it can be mapped in memory and read without parsing. See
+hpy/trace/src/trace_internal.h for the exact layout.
+
+This module does not need hpy.universal and can be used from the command
+line to post-process a dump offline::
+
+    python -m hpy.trace.events trace.bin --chrome trace.json
+    python -m hpy.trace.events trace.bin --profile
+"""
+
+import json
+import mmap
+import struct
+from collections import namedtuple
+
+MAGIC = b'HPYTRACE'
+VERSION = 1
+
+_HEADER = struct.Struct('=8sIIQQQQII')
+_EVENT = struct.Struct('=QQQII')
+_LENGTH = struct.Struct('=I')
+
+Event = namedtuple('Event', ['start_ns', 'duration_ns', 'thread_id',
+                             'func', 'module'])
+
+
+class EventFile:
+    """
+    A dump of the trace event buffer. The events are decoded lazily from the
+    mapped file; use it as a context manager to release the mapping.
+    """
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self._buf = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        (magic, version, event_size, self.n_events, self.n_dropped,
+         self._events_offset, strings_offset, n_funcs,
+         n_modules) = _HEADER.unpack_from(self._buf, 0)
+        if magic != MAGIC:
+            self.close()
+            raise ValueError('%s is not an HPy trace event file' % path)
+        if version != VERSION or event_size != _EVENT.size:
+            self.close()
+            raise ValueError('unsupported HPy trace event file version: %d'
+                             % version)
+        offset = strings_offset
+        strings = []
+        for i in range(n_funcs + n_modules):
+            n, = _LENGTH.unpack_from(self._buf, offset)
+            offset += _LENGTH.size
+            strings.append(self._buf[offset:offset+n].decode('utf-8'))
+            offset += n
+        self.func_names = strings[:n_funcs]
+        self.module_names = strings[n_funcs:]
+
+    def close(self):
+        self._buf.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def __len__(self):
+        return self.n_events
+
+    def __iter__(self):
+        func_names = self.func_names
+        module_names = self.module_names
+        for start, duration, tid, func_id, module_id in _EVENT.iter_unpack(
+                self._buf[self._events_offset:
+                          self._events_offset + self.n_events * _EVENT.size]):
+            yield Event(start, duration, tid, func_names[func_id],
+                        module_names[module_id])
+
+
+def read_events(path):
+    """
+    Return the list of events stored in the given file, oldest first.
+    """
+    with EventFile(path) as f:
+        return list(f)
+
+
+def to_chrome_trace(events):
+    """
+    Convert the events to the Chrome trace event format, which can be loaded
+    in chrome://tracing or Perfetto. The thread ids are renumbered from 1 in
+    order of appearance.
+    """
+    tids = {}
+    trace_events = []
+    for ev in events:
+        tid = tids.setdefault(ev.thread_id, len(tids) + 1)
+        trace_events.append({
+            'name': ev.func,
+            'cat': ev.module or 'hpy',
+            'ph': 'X',
+            'ts': ev.start_ns / 1000.0,
+            'dur': ev.duration_ns / 1000.0,
+            'pid': 1,
+            'tid': tid,
+        })
+    return {'traceEvents': trace_events, 'displayTimeUnit': 'ns'}
+
+
+ProfileEntry = namedtuple('ProfileEntry', ['func', 'count', 'total_ns',
+                                           'mean_ns', 'max_ns'])
+
+
+def flat_profile(events):
+    """
+    Aggregate the events by function and return a list of ProfileEntry,
+    sorted by decreasing total duration.
+    """
+    stats = {}
+    for ev in events:
+        entry = stats.get(ev.func)
+        if entry is None:
+            stats[ev.func] = [1, ev.duration_ns, ev.duration_ns]
+        else:
+            entry[0] += 1
+            entry[1] += ev.duration_ns
+            entry[2] = max(entry[2], ev.duration_ns)
+    res = [ProfileEntry(func, count, total, total // count, max_ns)
+           for func, (count, total, max_ns) in stats.items()]
+    res.sort(key=lambda e: e.total_ns, reverse=True)
+    return res
+
+
+def format_profile(profile):
+    lines = ['%-30s %10s %14s %12s %12s' % ('function', 'calls', 'total [ns]',
+                                           'mean [ns]', 'max [ns]')]
+    for e in profile:
+        lines.append('%-30s %10d %14d %12d %12d' % e)
+    return '\n'.join(lines)
+
+
+def main(argv=None):
+    import argparse
+    parser = argparse.ArgumentParser(
+        prog='python -m hpy.trace.events',
+        description='Convert an HPy trace event file.')
+    parser.add_argument('path', help='file written by hpy.trace.dump_events()')
+    parser.add_argument('--chrome', metavar='OUT',
+                        help='write a Chrome trace/Perfetto JSON file')
+    parser.add_argument('--profile', action='store_true',
+                        help='print a flat profile (the default)')
+    args = parser.parse_args(argv)
+    events = read_events(args.path)
+    if args.chrome:
+        with open(args.chrome, 'w') as f:
+            json.dump(to_chrome_trace(events), f)
+    if args.profile or not args.chrome:
+        print(format_profile(flat_profile(events)))
+
+
+if __name__ == '__main__':
+    main()
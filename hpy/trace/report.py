@@ -0,0 +1,55 @@
+"""
+Run a Python script with all the HPy modules loaded in trace mode and print
+the API functions with the worst tail latencies::
+
+    python -m hpy.trace.report [-n 20] script.py [args...]
+
+For each HPy API function, the report shows the number of timed calls and
+the estimated 50th and 99th percentiles and the maximum of their durations.
+The percentiles come from the latency histograms of the trace mode, see
+hpy.trace.get_latency_stats().
+"""
+
+import os
+import sys
+
+
+def format_latency_report(stats):
+    lines = ['%-30s %10s %12s %12s %12s' % ('function', 'calls', 'p50 [ns]',
+                                           'p99 [ns]', 'max [ns]')]
+    for s in stats:
+        lines.append('%-30s %10d %12d %12d %12d' % s)
+    return '\n'.join(lines)
+
+
+def main(argv=None):
+    import argparse
+    import runpy
+    parser = argparse.ArgumentParser(
+        prog='python -m hpy.trace.report',
+        description='Run a script in HPy trace mode and report the API '
+                    'functions with the worst tail latencies.')
+    parser.add_argument('-n', '--top', type=int, default=20,
+                        help='number of functions to show (default: 20)')
+    parser.add_argument('--sample-period', type=int, default=1,
+                        help='time only one every N calls of each function')
+    parser.add_argument('script', help='Python script to run')
+    parser.add_argument('args', nargs=argparse.REMAINDER,
+                        help='arguments of the script')
+    args = parser.parse_args(argv)
+    # the mode is read when each HPy module is loaded: an explicit HPY
+    # setting (e.g. only some modules in trace mode) is respected
+    os.environ.setdefault('HPY', 'trace')
+    from hpy.trace import get_latency_stats, set_sample_period
+    set_sample_period(args.sample_period)
+    saved_argv = sys.argv
+    sys.argv = [args.script] + args.args
+    try:
+        runpy.run_path(args.script, run_name='__main__')
+    finally:
+        sys.argv = saved_argv
+        print(format_latency_report(get_latency_stats()[:args.top]))
+
+
+if __name__ == '__main__':
+    main()
@@ -4,6 +4,7 @@
 // NOTE: hpy.trace._trace is loaded using the UNIVERSAL ctx. To make it
 // clearer, we will use "uctx" and "tctx" to distinguish them.
 
+#include <string.h>
 #include "hpy.h"
 #include "trace_internal.h"
 
@@ -55,11 +56,99 @@ static inline HPy posix_time_to_ns(HPyContext *uctx, HPy *s_to_ns, _HPyTime_t t)
 }
 #endif
 
-HPyDef_METH(get_durations, "get_durations", HPyFunc_NOARGS)
-static HPy get_durations_impl(HPyContext *uctx, HPy self)
+#ifndef _WIN32
+static inline void add_time(_HPyTime_t *res, const _HPyTime_t *t)
+{
+    res->tv_sec += t->tv_sec;
+    res->tv_nsec += t->tv_nsec;
+    if (res->tv_nsec >= FREQ_NSEC) {
+        res->tv_sec += res->tv_nsec / FREQ_NSEC;
+        res->tv_nsec %= FREQ_NSEC;
+    }
+}
+#endif
+
+/* The counters are split between the global trace info and the infos of the
+   modules, and each info has one shard of counters per thread. If
+   'all_modules' is true, sum the counters of 'info' and of all the module
+   infos following it; otherwise, just take the ones of 'info'. The
+   MAX_DURATIONS are not summed: the largest one is taken instead. */
+
+enum { CALL_COUNTS, TIMED_COUNTS, MAX_DURATIONS };
+
+static uint64_t
+sum_counts(HPyTraceInfo *info, int kind, int i, bool all_modules)
+{
+    uint64_t res = 0;
+    for (; info != NULL; info = all_modules ? info->next_module : NULL) {
+        for (HPyTraceShard *s = hpy_trace_first_shard(info); s; s = s->next) {
+            switch (kind) {
+            case CALL_COUNTS:
+                res += s->call_counts[i];
+                break;
+            case TIMED_COUNTS:
+                res += s->timed_counts[i];
+                break;
+            case MAX_DURATIONS:
+                if (s->max_durations[i] > res)
+                    res = s->max_durations[i];
+                break;
+            }
+        }
+    }
+    return res;
+}
+
+/* Sum the histograms of function 'i' into 'res' and return the total count */
+static uint64_t
+sum_histograms(HPyTraceInfo *info, int i, uint64_t *res)
+{
+    uint64_t total = 0;
+    memset(res, 0, HPY_TRACE_HIST_NBUCKETS * sizeof(uint64_t));
+    for (; info != NULL; info = info->next_module) {
+        for (HPyTraceShard *s = hpy_trace_first_shard(info); s; s = s->next) {
+            const uint64_t *h = &s->histograms[(size_t)i * HPY_TRACE_HIST_NBUCKETS];
+            for (int b = 0; b < HPY_TRACE_HIST_NBUCKETS; b++) {
+                res[b] += h[b];
+                total += h[b];
+            }
+        }
+    }
+    return total;
+}
+
+static HPy build_uint64_list(HPyContext *uctx, const uint64_t *values,
+                             HPy_ssize_t n)
+{
+    HPyListBuilder builder = HPyListBuilder_New(uctx, n);
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        HPy value = HPyLong_FromUInt64_t(uctx, values[i]);
+        HPyListBuilder_Set(uctx, builder, i, value);
+        HPy_Close(uctx, value);
+    }
+    return HPyListBuilder_Build(uctx, builder);
+}
+
+static _HPyTime_t
+sum_durations(HPyTraceInfo *info, int i, bool all_modules)
+{
+    _HPyTime_t res;
+    memset(&res, 0, sizeof(res));
+    for (; info != NULL; info = all_modules ? info->next_module : NULL) {
+        for (HPyTraceShard *s = hpy_trace_first_shard(info); s; s = s->next) {
+#ifdef _WIN32
+            res.QuadPart += s->durations[i].QuadPart;
+#else
+            add_time(&res, &s->durations[i]);
+#endif
+        }
+    }
+    return res;
+}
+
+static HPy build_durations_dict(HPyContext *uctx, HPyTraceInfo *info,
+                                bool all_modules)
 {
-    HPyContext *tctx = hpy_trace_get_ctx(uctx);
-    HPyTraceInfo *info = get_info(tctx);
     HPyTracker ht = HPyTracker_New(uctx, hpy_trace_get_nfunc());
 
 #ifdef _WIN32
@@ -74,10 +163,11 @@ static HPy get_durations_impl(HPyContext *uctx, HPy self)
         /* skip empty names; those indices denote a context handle */
         if (!is_empty(func_name))
         {
+            _HPyTime_t duration = sum_durations(info, i, all_modules);
 #ifdef _WIN32
-            HPy value = win_time_to_ns(uctx, to_ns, info->durations[i]);
+            HPy value = win_time_to_ns(uctx, to_ns, duration);
 #else
-            HPy value = posix_time_to_ns(uctx, &s_to_ns, info->durations[i]);
+            HPy value = posix_time_to_ns(uctx, &s_to_ns, duration);
 #endif
             HPyTracker_Add(uctx, ht, value);
             if (HPy_IsNull(value))
@@ -92,16 +182,17 @@ static HPy get_durations_impl(HPyContext *uctx, HPy self)
     HPyTracker_Close(uctx, ht);
     return res;
 fail:
+#ifndef _WIN32
+    HPy_Close(uctx, s_to_ns);
+#endif
     HPy_Close(uctx, res);
     HPyTracker_Close(uctx, ht);
     return HPy_NULL;
 }
 
-HPyDef_METH(get_call_counts, "get_call_counts", HPyFunc_NOARGS)
-static HPy get_call_counts_impl(HPyContext *uctx, HPy self)
+static HPy build_counts_dict(HPyContext *uctx, HPyTraceInfo *info, int kind,
+                             bool all_modules)
 {
-    HPyContext *tctx = hpy_trace_get_ctx(uctx);
-    HPyTraceInfo *info = get_info(tctx);
     HPyTracker ht = HPyTracker_New(uctx, hpy_trace_get_nfunc());
     HPy res = HPyDict_New(uctx);
     const char *func_name;
@@ -110,8 +201,9 @@ static HPy get_call_counts_impl(HPyContext *uctx, HPy self)
         /* skip empty names; those indices denote a context handle */
         if (!is_empty(func_name))
         {
+            uint64_t count = sum_counts(info, kind, i, all_modules);
             HPy value = HPyLong_FromUnsignedLongLong(uctx,
-                    (unsigned long long)info->call_counts[i]);
+                    (unsigned long long)count);
             HPyTracker_Add(uctx, ht, value);
             if (HPy_IsNull(value))
                 goto fail;
@@ -127,6 +219,156 @@ fail:
     return HPy_NULL;
 }
 
+/* Build a dict {module_name: {func_name: value}}; 'durations' selects
+   between build_durations_dict and build_counts_dict(CALL_COUNTS) */
+static HPy build_by_module_dict(HPyContext *uctx, HPyTraceInfo *main,
+                                bool durations)
+{
+    HPy res = HPyDict_New(uctx);
+    if (HPy_IsNull(res))
+        return HPy_NULL;
+    for (HPyTraceInfo *m = main->next_module; m != NULL; m = m->next_module) {
+        HPy value = durations ? build_durations_dict(uctx, m, false) :
+                                build_counts_dict(uctx, m, CALL_COUNTS, false);
+        if (HPy_IsNull(value))
+            goto fail;
+        int r = HPy_SetItem_s(uctx, res, m->module_name, value);
+        HPy_Close(uctx, value);
+        if (r < 0)
+            goto fail;
+    }
+    return res;
+fail:
+    HPy_Close(uctx, res);
+    return HPy_NULL;
+}
+
+HPyDef_METH(get_durations, "get_durations", HPyFunc_NOARGS)
+static HPy get_durations_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    return build_durations_dict(uctx, info, true);
+}
+
+HPyDef_METH(get_call_counts, "get_call_counts", HPyFunc_NOARGS)
+static HPy get_call_counts_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    return build_counts_dict(uctx, info, CALL_COUNTS, true);
+}
+
+HPyDef_METH(get_durations_by_module, "get_durations_by_module", HPyFunc_NOARGS,
+        .doc="Like get_durations but return a dict of such dicts, one for "
+             "each module loaded in trace mode.")
+static HPy get_durations_by_module_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    return build_by_module_dict(uctx, get_info(tctx), true);
+}
+
+HPyDef_METH(get_call_counts_by_module, "get_call_counts_by_module", HPyFunc_NOARGS,
+        .doc="Like get_call_counts but return a dict of such dicts, one for "
+             "each module loaded in trace mode.")
+static HPy get_call_counts_by_module_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    return build_by_module_dict(uctx, get_info(tctx), false);
+}
+
+HPyDef_METH(get_timed_call_counts, "get_timed_call_counts", HPyFunc_NOARGS,
+        .doc="Return how many calls of each HPy API function have been timed, "
+             "i.e. are included in the durations.")
+static HPy get_timed_call_counts_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    return build_counts_dict(uctx, info, TIMED_COUNTS, true);
+}
+
+HPyDef_METH(get_max_durations, "get_max_durations", HPyFunc_NOARGS,
+        .doc="Return the duration of the longest timed call of each HPy API "
+             "function, in nanoseconds.")
+static HPy get_max_durations_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    return build_counts_dict(uctx, info, MAX_DURATIONS, true);
+}
+
+HPyDef_METH(get_histograms, "get_histograms", HPyFunc_NOARGS,
+        .doc="Return a dict which maps the name of each HPy API function "
+             "which has been timed at least once to a list with the number "
+             "of timed calls in each bucket of get_histogram_bounds().")
+static HPy get_histograms_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    uint64_t counts[HPY_TRACE_HIST_NBUCKETS];
+    HPy res = HPyDict_New(uctx);
+    if (HPy_IsNull(res))
+        return HPy_NULL;
+    const char *func_name;
+    for (int i=0; (func_name = hpy_trace_get_func_name(i)); i++)
+    {
+        if (is_empty(func_name) || sum_histograms(info, i, counts) == 0)
+            continue;
+        HPy value = build_uint64_list(uctx, counts, HPY_TRACE_HIST_NBUCKETS);
+        if (HPy_IsNull(value))
+            goto fail;
+        int r = HPy_SetItem_s(uctx, res, func_name, value);
+        HPy_Close(uctx, value);
+        if (r < 0)
+            goto fail;
+    }
+    return res;
+fail:
+    HPy_Close(uctx, res);
+    return HPy_NULL;
+}
+
+HPyDef_METH(get_histogram_bounds, "get_histogram_bounds", HPyFunc_NOARGS,
+        .doc="Return the lower bound (in nanoseconds) of each bucket of the "
+             "histograms. The last bucket has no upper bound.")
+static HPy get_histogram_bounds_impl(HPyContext *uctx, HPy self)
+{
+    uint64_t bounds[HPY_TRACE_HIST_NBUCKETS];
+    for (uint32_t b = 0; b < HPY_TRACE_HIST_NBUCKETS; b++)
+        bounds[b] = hpy_trace_hist_lower_bound(b);
+    return build_uint64_list(uctx, bounds, HPY_TRACE_HIST_NBUCKETS);
+}
+
+HPyDef_METH(get_sample_period, "get_sample_period", HPyFunc_NOARGS,
+        .doc="Return N if only one every N calls of each HPy API function "
+             "is timed.")
+static HPy get_sample_period_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    return HPyLong_FromUnsignedLongLong(uctx,
+            (unsigned long long)info->sample_period);
+}
+
+HPyDef_METH(set_sample_period, "set_sample_period", HPyFunc_O,
+        .doc="Time only one every N calls of each HPy API function. All calls "
+             "are counted anyway. N=1 (the default) times every call.")
+static HPy set_sample_period_impl(HPyContext *uctx, HPy self, HPy arg)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    uint64_t period = HPyLong_AsUInt64_t(uctx, arg);
+    if (period == (uint64_t)-1 && HPyErr_Occurred(uctx))
+        return HPy_NULL;
+    if (period == 0) {
+        HPyErr_SetString(uctx, uctx->h_ValueError,
+                "the sample period must be at least 1");
+        return HPy_NULL;
+    }
+    info->sample_period = period;
+    return HPy_Dup(uctx, uctx->h_None);
+}
+
 static int check_and_set_func(HPyContext *uctx, HPy arg, HPy *out)
 {
     if (HPy_IsNull(arg)) {
@@ -187,14 +429,68 @@ static HPy get_frequency_impl(HPyContext *uctx, HPy self)
     return HPyLong_FromLongLong(uctx, f);
 }
 
+HPyDef_METH(get_event_buffer_size, "get_event_buffer_size", HPyFunc_NOARGS,
+        .doc="Return how many events the event buffer can hold, or 0 if "
+             "events are not recorded.")
+static HPy get_event_buffer_size_impl(HPyContext *uctx, HPy self)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    return HPyLong_FromUInt64_t(uctx, hpy_trace_get_event_buffer_size(info));
+}
+
+HPyDef_METH(set_event_buffer_size, "set_event_buffer_size", HPyFunc_O,
+        .doc="Record an event for each timed call of an HPy API function in "
+             "a new ring buffer which can hold (at least) N events; N=0 "
+             "stops recording. Any previously recorded event is discarded.")
+static HPy set_event_buffer_size_impl(HPyContext *uctx, HPy self, HPy arg)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    uint64_t size = HPyLong_AsUInt64_t(uctx, arg);
+    if (size == (uint64_t)-1 && HPyErr_Occurred(uctx))
+        return HPy_NULL;
+    if (hpy_trace_set_event_buffer_size(info, size) < 0)
+        return HPyErr_NoMemory(uctx);
+    return HPy_Dup(uctx, uctx->h_None);
+}
+
+HPyDef_METH(dump_events, "dump_events", HPyFunc_O,
+        .doc="Write the recorded events to the given file and return how "
+             "many they are. Use hpy.trace.events to read the file.")
+static HPy dump_events_impl(HPyContext *uctx, HPy self, HPy arg)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    HPyTraceInfo *info = get_info(tctx);
+    const char *path = HPyUnicode_AsUTF8AndSize(uctx, arg, NULL);
+    if (path == NULL)
+        return HPy_NULL;
+    int64_t n = hpy_trace_dump_events(info, path);
+    if (n < 0)
+        return HPyErr_SetFromErrnoWithFilename(uctx, uctx->h_OSError, path);
+    return HPyLong_FromInt64_t(uctx, n);
+}
+
+
 
 /* ~~~~~~ definition of the module hpy.trace._trace ~~~~~~~ */
 
 static HPyDef *module_defines[] = {
     &get_durations,
     &get_call_counts,
+    &get_durations_by_module,
+    &get_call_counts_by_module,
+    &get_timed_call_counts,
+    &get_max_durations,
+    &get_histograms,
+    &get_histogram_bounds,
+    &get_sample_period,
+    &set_sample_period,
     &set_trace_functions,
     &get_frequency,
+    &get_event_buffer_size,
+    &set_event_buffer_size,
+    &dump_events,
     NULL
 };
 
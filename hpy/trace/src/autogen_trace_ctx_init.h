@@ -12,6 +12,8 @@
 
 HPy trace_ctx_Dup(HPyContext *tctx, HPy h);
 void trace_ctx_Close(HPyContext *tctx, HPy h);
+void trace_ctx_CloseMany(HPyContext *tctx, const HPy *hs, HPy_ssize_t n);
+void trace_ctx_DupMany(HPyContext *tctx, const HPy *hs, HPy *out, HPy_ssize_t n);
 HPy trace_ctx_Long_FromInt32_t(HPyContext *tctx, int32_t value);
 HPy trace_ctx_Long_FromUInt32_t(HPyContext *tctx, uint32_t value);
 HPy trace_ctx_Long_FromInt64_t(HPyContext *tctx, int64_t v);
@@ -71,9 +73,11 @@ int trace_ctx_Callable_Check(HPyContext *tctx, HPy h);
 HPy trace_ctx_CallTupleDict(HPyContext *tctx, HPy callable, HPy args, HPy kw);
 HPy trace_ctx_Call(HPyContext *tctx, HPy callable, const HPy *args, size_t nargs, HPy kwnames);
 HPy trace_ctx_CallMethod(HPyContext *tctx, HPy name, const HPy *args, size_t nargs, HPy kwnames);
+HPy trace_ctx_CallMethodCached(HPyContext *tctx, HPyCallSite *site, const HPy *args, size_t nargs);
 HPy trace_ctx_GetIter(HPyContext *tctx, HPy obj);
 HPy trace_ctx_Iter_Next(HPyContext *tctx, HPy obj);
 int trace_ctx_Iter_Check(HPyContext *tctx, HPy obj);
+HPy_ssize_t trace_ctx_Iter_NextBatch(HPyContext *tctx, HPy obj, HPy *items, HPy_ssize_t n);
 void trace_ctx_Err_SetString(HPyContext *tctx, HPy h_type, const char *utf8_message);
 void trace_ctx_Err_SetObject(HPyContext *tctx, HPy h_type, HPy h_value);
 HPy trace_ctx_Err_SetFromErrnoWithFilename(HPyContext *tctx, HPy h_type, const char *filename_fsencoded);
@@ -124,6 +128,7 @@ void *trace_ctx_AsStruct_List(HPyContext *tctx, HPy h);
 void *trace_ctx_AsStruct_Dict(HPyContext *tctx, HPy h);
 HPyType_BuiltinShape trace_ctx_Type_GetBuiltinShape(HPyContext *tctx, HPy h_type);
 HPy trace_ctx_New(HPyContext *tctx, HPy h_type, void **data);
+HPy trace_ctx_StructSequence_New(HPyContext *tctx, HPy type, HPy_ssize_t nargs, const HPy *args);
 HPy trace_ctx_Repr(HPyContext *tctx, HPy obj);
 HPy trace_ctx_Str(HPyContext *tctx, HPy obj);
 HPy trace_ctx_ASCII(HPyContext *tctx, HPy obj);
@@ -131,6 +136,10 @@ HPy trace_ctx_Bytes(HPyContext *tctx, HPy obj);
 HPy trace_ctx_RichCompare(HPyContext *tctx, HPy v, HPy w, int op);
 int trace_ctx_RichCompareBool(HPyContext *tctx, HPy v, HPy w, int op);
 HPy_hash_t trace_ctx_Hash(HPyContext *tctx, HPy obj);
+int trace_ctx_GetBuffer(HPyContext *tctx, HPy obj, HPy_buffer *view, int flags);
+void trace_ctx_Buffer_Release(HPyContext *tctx, HPy_buffer *view);
+int trace_ctx_Buffer_IsContiguous(HPyContext *tctx, const HPy_buffer *view, char order);
+int trace_ctx_Buffer_ToContiguous(HPyContext *tctx, void *buf, const HPy_buffer *view, HPy_ssize_t len, char order);
 int trace_ctx_Bytes_Check(HPyContext *tctx, HPy h);
 HPy_ssize_t trace_ctx_Bytes_Size(HPyContext *tctx, HPy h);
 HPy_ssize_t trace_ctx_Bytes_GET_SIZE(HPyContext *tctx, HPy h);
@@ -161,6 +170,7 @@ int trace_ctx_Dict_Check(HPyContext *tctx, HPy h);
 HPy trace_ctx_Dict_New(HPyContext *tctx);
 HPy trace_ctx_Dict_Keys(HPyContext *tctx, HPy h);
 HPy trace_ctx_Dict_Copy(HPyContext *tctx, HPy h);
+int trace_ctx_Dict_Next(HPyContext *tctx, HPy h, HPy_ssize_t *pos, HPy *key, HPy *value);
 int trace_ctx_Tuple_Check(HPyContext *tctx, HPy h);
 HPy trace_ctx_Tuple_FromArray(HPyContext *tctx, const HPy items[], HPy_ssize_t n);
 HPy trace_ctx_Slice_New(HPyContext *tctx, HPy start, HPy stop, HPy step);
@@ -180,12 +190,19 @@ HPyTupleBuilder trace_ctx_TupleBuilder_New(HPyContext *tctx, HPy_ssize_t size);
 void trace_ctx_TupleBuilder_Set(HPyContext *tctx, HPyTupleBuilder builder, HPy_ssize_t index, HPy h_item);
 HPy trace_ctx_TupleBuilder_Build(HPyContext *tctx, HPyTupleBuilder builder);
 void trace_ctx_TupleBuilder_Cancel(HPyContext *tctx, HPyTupleBuilder builder);
+HPyDictBuilder trace_ctx_DictBuilder_New(HPyContext *tctx, HPy_ssize_t size);
+int trace_ctx_DictBuilder_Set(HPyContext *tctx, HPyDictBuilder builder, HPy h_key, HPy h_value);
+int trace_ctx_DictBuilder_Set_s(HPyContext *tctx, HPyDictBuilder builder, const char *utf8_key, HPy h_value);
+HPy trace_ctx_DictBuilder_Build(HPyContext *tctx, HPyDictBuilder builder);
+void trace_ctx_DictBuilder_Cancel(HPyContext *tctx, HPyDictBuilder builder);
 HPyTracker trace_ctx_Tracker_New(HPyContext *tctx, HPy_ssize_t size);
 int trace_ctx_Tracker_Add(HPyContext *tctx, HPyTracker ht, HPy h);
 void trace_ctx_Tracker_ForgetAll(HPyContext *tctx, HPyTracker ht);
 void trace_ctx_Tracker_Close(HPyContext *tctx, HPyTracker ht);
 void trace_ctx_Field_Store(HPyContext *tctx, HPy target_object, HPyField *target_field, HPy h);
 HPy trace_ctx_Field_Load(HPyContext *tctx, HPy source_object, HPyField source_field);
+void trace_ctx_Field_StoreMany(HPyContext *tctx, HPy target_object, HPyField **target_fields, const HPy *hs, HPy_ssize_t n);
+void trace_ctx_Field_LoadMany(HPyContext *tctx, HPy source_object, HPyField **source_fields, HPy *out, HPy_ssize_t n);
 void trace_ctx_ReenterPythonExecution(HPyContext *tctx, HPyThreadState state);
 HPyThreadState trace_ctx_LeavePythonExecution(HPyContext *tctx);
 void trace_ctx_Global_Store(HPyContext *tctx, HPyGlobal *global, HPy h);
@@ -198,12 +215,44 @@ int32_t trace_ctx_ContextVar_Get(HPyContext *tctx, HPy context_var, HPy default_
 HPy trace_ctx_ContextVar_Set(HPyContext *tctx, HPy context_var, HPy value);
 int trace_ctx_SetCallFunction(HPyContext *tctx, HPy h, HPyCallFunction *func);
 
+static inline void trace_ctx_free_shard(HPyTraceShard *shard)
+{
+    free(shard->call_counts);
+    free(shard->durations);
+    free(shard->timed_counts);
+    free(shard->histograms);
+    free(shard->max_durations);
+    free(shard);
+}
+
+static inline HPyTraceShard *trace_ctx_new_shard(HPyTraceInfo *info)
+{
+    HPyTraceShard *shard = (HPyTraceShard *)malloc(sizeof(HPyTraceShard));
+    if (shard == NULL)
+        return NULL;
+    shard->info = info;
+    shard->next = NULL;
+    shard->call_counts = (uint64_t *)calloc(291, sizeof(uint64_t));
+    shard->durations = (_HPyTime_t *)calloc(291, sizeof(_HPyTime_t));
+    shard->timed_counts = (uint64_t *)calloc(291, sizeof(uint64_t));
+    shard->histograms = (uint64_t *)calloc(291 * HPY_TRACE_HIST_NBUCKETS,
+                                           sizeof(uint64_t));
+    shard->max_durations = (uint64_t *)calloc(291, sizeof(uint64_t));
+    if (shard->call_counts == NULL || shard->durations == NULL ||
+            shard->timed_counts == NULL || shard->histograms == NULL ||
+            shard->max_durations == NULL) {
+        trace_ctx_free_shard(shard);
+        return NULL;
+    }
+    return shard;
+}
+
 static inline void trace_ctx_init_info(HPyTraceInfo *info, HPyContext *uctx)
 {
     info->magic_number = HPY_TRACE_MAGIC;
     info->uctx = uctx;
-    info->call_counts = (uint64_t *)calloc(273, sizeof(uint64_t));
-    info->durations = (_HPyTime_t *)calloc(273, sizeof(_HPyTime_t));
+    info->shards = NULL;
+    info->sample_period = 1;
     info->on_enter_func = HPy_NULL;
     info->on_exit_func = HPy_NULL;
 }
@@ -211,8 +260,12 @@ static inline void trace_ctx_init_info(HPyTraceInfo *info, HPyContext *uctx)
 static inline void trace_ctx_free_info(HPyTraceInfo *info)
 {
     assert(info->magic_number == HPY_TRACE_MAGIC);
-    free(info->call_counts);
-    free(info->durations);
+    HPyTraceShard *shard = info->shards;
+    while (shard != NULL) {
+        HPyTraceShard *next = shard->next;
+        trace_ctx_free_shard(shard);
+        shard = next;
+    }
     HPy_Close(info->uctx, info->on_enter_func);
     HPy_Close(info->uctx, info->on_exit_func);
 }
@@ -305,6 +358,8 @@ static inline void trace_ctx_init_fields(HPyContext *tctx, HPyContext *uctx)
     tctx->h_Builtins = uctx->h_Builtins;
     tctx->ctx_Dup = &trace_ctx_Dup;
     tctx->ctx_Close = &trace_ctx_Close;
+    tctx->ctx_CloseMany = &trace_ctx_CloseMany;
+    tctx->ctx_DupMany = &trace_ctx_DupMany;
     tctx->ctx_Long_FromInt32_t = &trace_ctx_Long_FromInt32_t;
     tctx->ctx_Long_FromUInt32_t = &trace_ctx_Long_FromUInt32_t;
     tctx->ctx_Long_FromInt64_t = &trace_ctx_Long_FromInt64_t;
@@ -364,9 +419,11 @@ static inline void trace_ctx_init_fields(HPyContext *tctx, HPyContext *uctx)
     tctx->ctx_CallTupleDict = &trace_ctx_CallTupleDict;
     tctx->ctx_Call = &trace_ctx_Call;
     tctx->ctx_CallMethod = &trace_ctx_CallMethod;
+    tctx->ctx_CallMethodCached = &trace_ctx_CallMethodCached;
     tctx->ctx_GetIter = &trace_ctx_GetIter;
     tctx->ctx_Iter_Next = &trace_ctx_Iter_Next;
     tctx->ctx_Iter_Check = &trace_ctx_Iter_Check;
+    tctx->ctx_Iter_NextBatch = &trace_ctx_Iter_NextBatch;
     tctx->ctx_FatalError = uctx->ctx_FatalError;
     tctx->ctx_Err_SetString = &trace_ctx_Err_SetString;
     tctx->ctx_Err_SetObject = &trace_ctx_Err_SetObject;
@@ -418,6 +475,7 @@ static inline void trace_ctx_init_fields(HPyContext *tctx, HPyContext *uctx)
     tctx->ctx_AsStruct_Dict = &trace_ctx_AsStruct_Dict;
     tctx->ctx_Type_GetBuiltinShape = &trace_ctx_Type_GetBuiltinShape;
     tctx->ctx_New = &trace_ctx_New;
+    tctx->ctx_StructSequence_New = &trace_ctx_StructSequence_New;
     tctx->ctx_Repr = &trace_ctx_Repr;
     tctx->ctx_Str = &trace_ctx_Str;
     tctx->ctx_ASCII = &trace_ctx_ASCII;
@@ -425,6 +483,10 @@ static inline void trace_ctx_init_fields(HPyContext *tctx, HPyContext *uctx)
     tctx->ctx_RichCompare = &trace_ctx_RichCompare;
     tctx->ctx_RichCompareBool = &trace_ctx_RichCompareBool;
     tctx->ctx_Hash = &trace_ctx_Hash;
+    tctx->ctx_GetBuffer = &trace_ctx_GetBuffer;
+    tctx->ctx_Buffer_Release = &trace_ctx_Buffer_Release;
+    tctx->ctx_Buffer_IsContiguous = &trace_ctx_Buffer_IsContiguous;
+    tctx->ctx_Buffer_ToContiguous = &trace_ctx_Buffer_ToContiguous;
     tctx->ctx_Bytes_Check = &trace_ctx_Bytes_Check;
     tctx->ctx_Bytes_Size = &trace_ctx_Bytes_Size;
     tctx->ctx_Bytes_GET_SIZE = &trace_ctx_Bytes_GET_SIZE;
@@ -455,6 +517,7 @@ static inline void trace_ctx_init_fields(HPyContext *tctx, HPyContext *uctx)
     tctx->ctx_Dict_New = &trace_ctx_Dict_New;
     tctx->ctx_Dict_Keys = &trace_ctx_Dict_Keys;
     tctx->ctx_Dict_Copy = &trace_ctx_Dict_Copy;
+    tctx->ctx_Dict_Next = &trace_ctx_Dict_Next;
     tctx->ctx_Tuple_Check = &trace_ctx_Tuple_Check;
     tctx->ctx_Tuple_FromArray = &trace_ctx_Tuple_FromArray;
     tctx->ctx_Slice_New = &trace_ctx_Slice_New;
@@ -475,12 +538,20 @@ static inline void trace_ctx_init_fields(HPyContext *tctx, HPyContext *uctx)
     tctx->ctx_TupleBuilder_Set = &trace_ctx_TupleBuilder_Set;
     tctx->ctx_TupleBuilder_Build = &trace_ctx_TupleBuilder_Build;
     tctx->ctx_TupleBuilder_Cancel = &trace_ctx_TupleBuilder_Cancel;
+    tctx->ctx_DictBuilder_New = &trace_ctx_DictBuilder_New;
+    tctx->ctx_DictBuilder_Set = &trace_ctx_DictBuilder_Set;
+    tctx->ctx_DictBuilder_Set_s = &trace_ctx_DictBuilder_Set_s;
+    tctx->ctx_DictBuilder_Build = &trace_ctx_DictBuilder_Build;
+    tctx->ctx_DictBuilder_Cancel = &trace_ctx_DictBuilder_Cancel;
     tctx->ctx_Tracker_New = &trace_ctx_Tracker_New;
     tctx->ctx_Tracker_Add = &trace_ctx_Tracker_Add;
     tctx->ctx_Tracker_ForgetAll = &trace_ctx_Tracker_ForgetAll;
     tctx->ctx_Tracker_Close = &trace_ctx_Tracker_Close;
     tctx->ctx_Field_Store = &trace_ctx_Field_Store;
     tctx->ctx_Field_Load = &trace_ctx_Field_Load;
+    tctx->ctx_Field_StoreMany = &trace_ctx_Field_StoreMany;
+    tctx->ctx_Field_LoadMany = &trace_ctx_Field_LoadMany;
+    tctx->ctx_Field_WriteBarrier = uctx->ctx_Field_WriteBarrier;
     tctx->ctx_ReenterPythonExecution = &trace_ctx_ReenterPythonExecution;
     tctx->ctx_LeavePythonExecution = &trace_ctx_LeavePythonExecution;
     tctx->ctx_Global_Store = &trace_ctx_Global_Store;
@@ -12,7 +12,7 @@
 
 #include "trace_internal.h"
 
-#define TRACE_NFUNC 189
+#define TRACE_NFUNC 207
 
 #define NO_FUNC ""
 static const char *trace_func_table[] = {
@@ -289,6 +289,24 @@ static const char *trace_func_table[] = {
     "ctx_Iter_Next",
     "ctx_Iter_Check",
     "ctx_Slice_New",
+    "ctx_CloseMany",
+    "ctx_DupMany",
+    "ctx_StructSequence_New",
+    "ctx_Field_StoreMany",
+    "ctx_Field_LoadMany",
+    "ctx_Field_WriteBarrier",
+    "ctx_CallMethodCached",
+    "ctx_Iter_NextBatch",
+    "ctx_GetBuffer",
+    "ctx_Buffer_Release",
+    "ctx_Buffer_IsContiguous",
+    "ctx_Buffer_ToContiguous",
+    "ctx_Dict_Next",
+    "ctx_DictBuilder_New",
+    "ctx_DictBuilder_Set",
+    "ctx_DictBuilder_Set_s",
+    "ctx_DictBuilder_Build",
+    "ctx_DictBuilder_Cancel",
     NULL /* sentinel */
 };
 
@@ -299,7 +317,7 @@ int hpy_trace_get_nfunc(void)
 
 const char * hpy_trace_get_func_name(int idx)
 {
-    if (idx >= 0 && idx < 273)
+    if (idx >= 0 && idx < 291)
         return trace_func_table[idx];
     return NULL;
 }
@@ -14,2415 +14,3242 @@
 
 HPy trace_ctx_Dup(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 77);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 77);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 77);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Dup(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 77, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 77, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Close(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 78);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 78);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 78);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_Close(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 78, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 78, timed, r0, r1, &_ts_start, &_ts_end);
+}
+
+void trace_ctx_CloseMany(HPyContext *tctx, const HPy *hs, HPy_ssize_t n)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 273);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 273);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPy_CloseMany(uctx, hs, n);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 273, timed, r0, r1, &_ts_start, &_ts_end);
+}
+
+void trace_ctx_DupMany(HPyContext *tctx, const HPy *hs, HPy *out, HPy_ssize_t n)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 274);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 274);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPy_DupMany(uctx, hs, out, n);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 274, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_Long_FromInt32_t(HPyContext *tctx, int32_t value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 79);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 79);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 79);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyLong_FromInt32_t(uctx, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 79, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 79, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Long_FromUInt32_t(HPyContext *tctx, uint32_t value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 80);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 80);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 80);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyLong_FromUInt32_t(uctx, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 80, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 80, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Long_FromInt64_t(HPyContext *tctx, int64_t v)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 81);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 81);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 81);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyLong_FromInt64_t(uctx, v);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 81, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 81, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Long_FromUInt64_t(HPyContext *tctx, uint64_t v)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 82);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 82);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 82);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyLong_FromUInt64_t(uctx, v);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 82, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 82, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Long_FromSize_t(HPyContext *tctx, size_t value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 83);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 83);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 83);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyLong_FromSize_t(uctx, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 83, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 83, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Long_FromSsize_t(HPyContext *tctx, HPy_ssize_t value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 84);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 84);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 84);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyLong_FromSsize_t(uctx, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 84, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 84, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int32_t trace_ctx_Long_AsInt32_t(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 85);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 85);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 85);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int32_t res = HPyLong_AsInt32_t(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 85, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 85, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 uint32_t trace_ctx_Long_AsUInt32_t(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 86);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 86);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 86);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     uint32_t res = HPyLong_AsUInt32_t(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 86, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 86, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 uint32_t trace_ctx_Long_AsUInt32_tMask(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 87);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 87);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 87);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     uint32_t res = HPyLong_AsUInt32_tMask(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 87, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 87, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int64_t trace_ctx_Long_AsInt64_t(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 88);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 88);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 88);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int64_t res = HPyLong_AsInt64_t(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 88, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 88, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 uint64_t trace_ctx_Long_AsUInt64_t(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 89);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 89);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 89);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     uint64_t res = HPyLong_AsUInt64_t(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 89, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 89, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 uint64_t trace_ctx_Long_AsUInt64_tMask(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 90);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 90);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 90);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     uint64_t res = HPyLong_AsUInt64_tMask(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 90, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 90, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 size_t trace_ctx_Long_AsSize_t(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 91);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 91);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 91);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     size_t res = HPyLong_AsSize_t(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 91, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 91, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy_ssize_t trace_ctx_Long_AsSsize_t(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 92);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 92);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 92);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_ssize_t res = HPyLong_AsSsize_t(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 92, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 92, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_Long_AsVoidPtr(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 93);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 93);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 93);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = HPyLong_AsVoidPtr(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 93, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 93, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 double trace_ctx_Long_AsDouble(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 94);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 94);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 94);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     double res = HPyLong_AsDouble(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 94, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 94, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Float_FromDouble(HPyContext *tctx, double v)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 95);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 95);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 95);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyFloat_FromDouble(uctx, v);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 95, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 95, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 double trace_ctx_Float_AsDouble(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 96);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 96);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 96);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     double res = HPyFloat_AsDouble(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 96, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 96, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Bool_FromBool(HPyContext *tctx, bool v)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 97);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 97);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 97);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyBool_FromBool(uctx, v);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 97, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 97, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy_ssize_t trace_ctx_Length(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 98);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 98);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 98);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_ssize_t res = HPy_Length(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 98, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 98, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Number_Check(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 99);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 99);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 99);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyNumber_Check(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 99, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 99, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Add(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 100);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 100);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 100);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Add(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 100, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 100, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Subtract(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 101);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 101);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 101);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Subtract(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 101, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 101, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Multiply(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 102);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 102);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 102);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Multiply(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 102, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 102, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_MatrixMultiply(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 103);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 103);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 103);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_MatrixMultiply(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 103, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 103, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_FloorDivide(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 104);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 104);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 104);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_FloorDivide(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 104, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 104, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_TrueDivide(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 105);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 105);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 105);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_TrueDivide(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 105, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 105, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Remainder(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 106);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 106);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 106);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Remainder(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 106, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 106, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Divmod(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 107);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 107);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 107);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Divmod(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 107, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 107, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Power(HPyContext *tctx, HPy h1, HPy h2, HPy h3)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 108);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 108);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 108);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Power(uctx, h1, h2, h3);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 108, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 108, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Negative(HPyContext *tctx, HPy h1)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 109);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 109);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 109);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Negative(uctx, h1);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 109, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 109, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Positive(HPyContext *tctx, HPy h1)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 110);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 110);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 110);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Positive(uctx, h1);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 110, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 110, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Absolute(HPyContext *tctx, HPy h1)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 111);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 111);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 111);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Absolute(uctx, h1);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 111, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 111, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Invert(HPyContext *tctx, HPy h1)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 112);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 112);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 112);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Invert(uctx, h1);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 112, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 112, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Lshift(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 113);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 113);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 113);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Lshift(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 113, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 113, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Rshift(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 114);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 114);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 114);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Rshift(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 114, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 114, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_And(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 115);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 115);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 115);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_And(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 115, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 115, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Xor(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 116);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 116);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 116);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Xor(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 116, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 116, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Or(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 117);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 117);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 117);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Or(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 117, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 117, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Index(HPyContext *tctx, HPy h1)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 118);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 118);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 118);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Index(uctx, h1);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 118, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 118, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Long(HPyContext *tctx, HPy h1)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 119);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 119);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 119);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Long(uctx, h1);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 119, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 119, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Float(HPyContext *tctx, HPy h1)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 120);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 120);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 120);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Float(uctx, h1);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 120, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 120, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceAdd(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 121);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 121);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 121);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceAdd(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 121, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 121, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceSubtract(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 122);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 122);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 122);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceSubtract(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 122, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 122, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceMultiply(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 123);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 123);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 123);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceMultiply(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 123, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 123, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceMatrixMultiply(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 124);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 124);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 124);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceMatrixMultiply(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 124, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 124, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceFloorDivide(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 125);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 125);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 125);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceFloorDivide(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 125, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 125, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceTrueDivide(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 126);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 126);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 126);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceTrueDivide(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 126, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 126, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceRemainder(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 127);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 127);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 127);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceRemainder(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 127, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 127, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlacePower(HPyContext *tctx, HPy h1, HPy h2, HPy h3)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 128);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 128);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 128);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlacePower(uctx, h1, h2, h3);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 128, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 128, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceLshift(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 129);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 129);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 129);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceLshift(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 129, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 129, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceRshift(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 130);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 130);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 130);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceRshift(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 130, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 130, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceAnd(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 131);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 131);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 131);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceAnd(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 131, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 131, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceXor(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 132);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 132);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 132);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceXor(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 132, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 132, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_InPlaceOr(HPyContext *tctx, HPy h1, HPy h2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 133);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 133);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 133);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_InPlaceOr(uctx, h1, h2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 133, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 133, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Callable_Check(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 134);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 134);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 134);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyCallable_Check(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 134, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 134, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_CallTupleDict(HPyContext *tctx, HPy callable, HPy args, HPy kw)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 135);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 135);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 135);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_CallTupleDict(uctx, callable, args, kw);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 135, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 135, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Call(HPyContext *tctx, HPy callable, const HPy *args, size_t nargs, HPy kwnames)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 261);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 261);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 261);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Call(uctx, callable, args, nargs, kwnames);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 261, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 261, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_CallMethod(HPyContext *tctx, HPy name, const HPy *args, size_t nargs, HPy kwnames)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 262);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 262);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 262);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_CallMethod(uctx, name, args, nargs, kwnames);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 262, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 262, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+HPy trace_ctx_CallMethodCached(HPyContext *tctx, HPyCallSite *site, const HPy *args, size_t nargs)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 279);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 279);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPy res = HPy_CallMethodCached(uctx, site, args, nargs);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 279, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_GetIter(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 269);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 269);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 269);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_GetIter(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 269, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 269, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Iter_Next(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 270);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 270);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 270);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyIter_Next(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 270, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 270, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Iter_Check(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 271);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 271);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 271);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyIter_Check(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 271, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 271, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+HPy_ssize_t trace_ctx_Iter_NextBatch(HPyContext *tctx, HPy obj, HPy *items, HPy_ssize_t n)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 280);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 280);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPy_ssize_t res = HPyIter_NextBatch(uctx, obj, items, n);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 280, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Err_SetString(HPyContext *tctx, HPy h_type, const char *utf8_message)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 137);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 137);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 137);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyErr_SetString(uctx, h_type, utf8_message);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 137, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 137, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 void trace_ctx_Err_SetObject(HPyContext *tctx, HPy h_type, HPy h_value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 138);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 138);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 138);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyErr_SetObject(uctx, h_type, h_value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 138, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 138, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_Err_SetFromErrnoWithFilename(HPyContext *tctx, HPy h_type, const char *filename_fsencoded)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 139);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 139);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 139);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyErr_SetFromErrnoWithFilename(uctx, h_type, filename_fsencoded);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 139, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 139, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Err_SetFromErrnoWithFilenameObjects(HPyContext *tctx, HPy h_type, HPy filename1, HPy filename2)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 140);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 140);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 140);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyErr_SetFromErrnoWithFilenameObjects(uctx, h_type, filename1, filename2);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 140, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 140, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 int trace_ctx_Err_Occurred(HPyContext *tctx)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 141);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 141);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 141);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyErr_Occurred(uctx);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 141, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 141, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Err_ExceptionMatches(HPyContext *tctx, HPy exc)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 142);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 142);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 142);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyErr_ExceptionMatches(uctx, exc);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 142, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 142, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Err_NoMemory(HPyContext *tctx)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 143);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 143);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 143);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyErr_NoMemory(uctx);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 143, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 143, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 void trace_ctx_Err_Clear(HPyContext *tctx)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 144);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 144);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 144);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyErr_Clear(uctx);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 144, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 144, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_Err_NewException(HPyContext *tctx, const char *utf8_name, HPy base, HPy dict)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 145);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 145);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 145);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyErr_NewException(uctx, utf8_name, base, dict);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 145, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 145, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Err_NewExceptionWithDoc(HPyContext *tctx, const char *utf8_name, const char *utf8_doc, HPy base, HPy dict)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 146);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 146);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 146);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyErr_NewExceptionWithDoc(uctx, utf8_name, utf8_doc, base, dict);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 146, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 146, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Err_WarnEx(HPyContext *tctx, HPy category, const char *utf8_message, HPy_ssize_t stack_level)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 147);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 147);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 147);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyErr_WarnEx(uctx, category, utf8_message, stack_level);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 147, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 147, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Err_WriteUnraisable(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 148);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 148);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 148);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyErr_WriteUnraisable(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 148, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 148, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 int trace_ctx_IsTrue(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 149);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 149);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 149);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_IsTrue(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 149, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 149, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Type_FromSpec(HPyContext *tctx, HPyType_Spec *spec, HPyType_SpecParam *params)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 150);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 150);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 150);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyType_FromSpec(uctx, spec, params);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 150, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 150, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Type_GenericNew(HPyContext *tctx, HPy type, const HPy *args, HPy_ssize_t nargs, HPy kw)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 151);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 151);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 151);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyType_GenericNew(uctx, type, args, nargs, kw);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 151, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 151, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_GetAttr(HPyContext *tctx, HPy obj, HPy name)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 152);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 152);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 152);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_GetAttr(uctx, obj, name);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 152, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 152, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_GetAttr_s(HPyContext *tctx, HPy obj, const char *utf8_name)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 153);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 153);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 153);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_GetAttr_s(uctx, obj, utf8_name);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 153, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 153, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_HasAttr(HPyContext *tctx, HPy obj, HPy name)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 154);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 154);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 154);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_HasAttr(uctx, obj, name);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 154, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 154, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_HasAttr_s(HPyContext *tctx, HPy obj, const char *utf8_name)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 155);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 155);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 155);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_HasAttr_s(uctx, obj, utf8_name);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 155, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 155, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_SetAttr(HPyContext *tctx, HPy obj, HPy name, HPy value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 156);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 156);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 156);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_SetAttr(uctx, obj, name, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 156, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 156, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_SetAttr_s(HPyContext *tctx, HPy obj, const char *utf8_name, HPy value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 157);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 157);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 157);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_SetAttr_s(uctx, obj, utf8_name, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 157, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 157, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_GetItem(HPyContext *tctx, HPy obj, HPy key)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 158);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 158);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 158);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_GetItem(uctx, obj, key);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 158, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 158, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_GetItem_i(HPyContext *tctx, HPy obj, HPy_ssize_t idx)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 159);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 159);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 159);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_GetItem_i(uctx, obj, idx);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 159, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 159, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_GetItem_s(HPyContext *tctx, HPy obj, const char *utf8_key)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 160);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 160);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 160);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_GetItem_s(uctx, obj, utf8_key);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 160, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 160, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_GetSlice(HPyContext *tctx, HPy obj, HPy_ssize_t start, HPy_ssize_t end)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 266);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 266);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 266);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_GetSlice(uctx, obj, start, end);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 266, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 266, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Contains(HPyContext *tctx, HPy container, HPy key)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 161);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 161);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 161);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_Contains(uctx, container, key);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 161, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 161, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_SetItem(HPyContext *tctx, HPy obj, HPy key, HPy value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 162);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 162);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 162);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_SetItem(uctx, obj, key, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 162, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 162, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_SetItem_i(HPyContext *tctx, HPy obj, HPy_ssize_t idx, HPy value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 163);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 163);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 163);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_SetItem_i(uctx, obj, idx, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 163, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 163, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_SetItem_s(HPyContext *tctx, HPy obj, const char *utf8_key, HPy value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 164);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 164);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 164);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_SetItem_s(uctx, obj, utf8_key, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 164, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 164, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_SetSlice(HPyContext *tctx, HPy obj, HPy_ssize_t start, HPy_ssize_t end, HPy value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 267);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 267);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 267);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_SetSlice(uctx, obj, start, end, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 267, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 267, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_DelItem(HPyContext *tctx, HPy obj, HPy key)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 235);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 235);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 235);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_DelItem(uctx, obj, key);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 235, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 235, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_DelItem_i(HPyContext *tctx, HPy obj, HPy_ssize_t idx)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 236);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 236);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 236);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_DelItem_i(uctx, obj, idx);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 236, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 236, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_DelItem_s(HPyContext *tctx, HPy obj, const char *utf8_key)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 237);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 237);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 237);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_DelItem_s(uctx, obj, utf8_key);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 237, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 237, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_DelSlice(HPyContext *tctx, HPy obj, HPy_ssize_t start, HPy_ssize_t end)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 268);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 268);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 268);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_DelSlice(uctx, obj, start, end);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 268, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 268, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Type(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 165);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 165);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 165);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Type(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 165, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 165, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_TypeCheck(HPyContext *tctx, HPy obj, HPy type)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 166);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 166);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 166);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_TypeCheck(uctx, obj, type);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 166, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 166, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 const char *trace_ctx_Type_GetName(HPyContext *tctx, HPy type)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 253);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 253);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 253);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     const char * res = HPyType_GetName(uctx, type);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 253, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 253, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Type_IsSubtype(HPyContext *tctx, HPy sub, HPy type)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 254);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 254);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 254);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyType_IsSubtype(uctx, sub, type);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 254, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 254, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Is(HPyContext *tctx, HPy obj, HPy other)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 167);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 167);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 167);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_Is(uctx, obj, other);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 167, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 167, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Object(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 168);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 168);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 168);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Object(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 168, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 168, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Legacy(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 169);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 169);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 169);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Legacy(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 169, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 169, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Type(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 228);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 228);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 228);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Type(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 228, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 228, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Long(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 229);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 229);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 229);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Long(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 229, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 229, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Float(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 230);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 230);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 230);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Float(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 230, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 230, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Unicode(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 231);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 231);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 231);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Unicode(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 231, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 231, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Tuple(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 232);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 232);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 232);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Tuple(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 232, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 232, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_List(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 233);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 233);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 233);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_List(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 233, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 233, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_AsStruct_Dict(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 264);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 264);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 264);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = _HPy_AsStruct_Dict(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 264, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 264, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPyType_BuiltinShape trace_ctx_Type_GetBuiltinShape(HPyContext *tctx, HPy h_type)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 234);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 234);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 234);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyType_BuiltinShape res = _HPyType_GetBuiltinShape(uctx, h_type);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 234, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 234, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_New(HPyContext *tctx, HPy h_type, void **data)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 170);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 170);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 170);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = _HPy_New(uctx, h_type, data);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 170, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 170, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+HPy trace_ctx_StructSequence_New(HPyContext *tctx, HPy type, HPy_ssize_t nargs, const HPy *args)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 275);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 275);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPy res = _HPyStructSequence_New(uctx, type, nargs, args);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 275, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Repr(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 171);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 171);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 171);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Repr(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 171, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 171, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Str(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 172);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 172);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 172);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Str(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 172, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 172, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_ASCII(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 173);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 173);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 173);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_ASCII(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 173, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 173, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Bytes(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 174);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 174);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 174);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Bytes(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 174, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 174, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_RichCompare(HPyContext *tctx, HPy v, HPy w, int op)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 175);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 175);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 175);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_RichCompare(uctx, v, w, op);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 175, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 175, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_RichCompareBool(HPyContext *tctx, HPy v, HPy w, int op)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 176);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 176);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 176);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_RichCompareBool(uctx, v, w, op);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 176, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 176, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy_hash_t trace_ctx_Hash(HPyContext *tctx, HPy obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 177);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 177);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 177);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_hash_t res = HPy_Hash(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 177, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 177, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+int trace_ctx_GetBuffer(HPyContext *tctx, HPy obj, HPy_buffer *view, int flags)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 281);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 281);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    int res = HPy_GetBuffer(uctx, obj, view, flags);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 281, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+void trace_ctx_Buffer_Release(HPyContext *tctx, HPy_buffer *view)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 282);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 282);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPyBuffer_Release(uctx, view);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 282, timed, r0, r1, &_ts_start, &_ts_end);
+}
+
+int trace_ctx_Buffer_IsContiguous(HPyContext *tctx, const HPy_buffer *view, char order)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 283);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 283);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    int res = HPyBuffer_IsContiguous(uctx, view, order);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 283, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+int trace_ctx_Buffer_ToContiguous(HPyContext *tctx, void *buf, const HPy_buffer *view, HPy_ssize_t len, char order)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 284);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 284);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    int res = HPyBuffer_ToContiguous(uctx, buf, view, len, order);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 284, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Bytes_Check(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 178);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 178);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 178);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyBytes_Check(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 178, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 178, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy_ssize_t trace_ctx_Bytes_Size(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 179);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 179);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 179);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_ssize_t res = HPyBytes_Size(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 179, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 179, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy_ssize_t trace_ctx_Bytes_GET_SIZE(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 180);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 180);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 180);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_ssize_t res = HPyBytes_GET_SIZE(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 180, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 180, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 const char *trace_ctx_Bytes_AsString(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 181);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 181);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 181);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     const char * res = HPyBytes_AsString(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 181, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 181, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 const char *trace_ctx_Bytes_AS_STRING(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 182);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 182);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 182);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     const char * res = HPyBytes_AS_STRING(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 182, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 182, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Bytes_FromString(HPyContext *tctx, const char *bytes)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 183);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 183);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 183);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyBytes_FromString(uctx, bytes);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 183, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 183, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Bytes_FromStringAndSize(HPyContext *tctx, const char *bytes, HPy_ssize_t len)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 184);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 184);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 184);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyBytes_FromStringAndSize(uctx, bytes, len);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 184, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 184, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_FromString(HPyContext *tctx, const char *utf8)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 185);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 185);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 185);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_FromString(uctx, utf8);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 185, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 185, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Unicode_Check(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 186);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 186);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 186);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyUnicode_Check(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 186, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 186, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_AsASCIIString(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 187);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 187);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 187);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_AsASCIIString(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 187, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 187, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_AsLatin1String(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 188);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 188);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 188);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_AsLatin1String(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 188, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 188, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_AsUTF8String(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 189);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 189);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 189);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_AsUTF8String(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 189, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 189, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 const char *trace_ctx_Unicode_AsUTF8AndSize(HPyContext *tctx, HPy h, HPy_ssize_t *size)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 190);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 190);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 190);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     const char * res = HPyUnicode_AsUTF8AndSize(uctx, h, size);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 190, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 190, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_FromWideChar(HPyContext *tctx, const wchar_t *w, HPy_ssize_t size)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 191);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 191);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 191);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_FromWideChar(uctx, w, size);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 191, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 191, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_DecodeFSDefault(HPyContext *tctx, const char *v)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 192);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 192);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 192);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_DecodeFSDefault(uctx, v);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 192, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 192, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_DecodeFSDefaultAndSize(HPyContext *tctx, const char *v, HPy_ssize_t size)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 193);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 193);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 193);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_DecodeFSDefaultAndSize(uctx, v, size);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 193, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 193, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_EncodeFSDefault(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 194);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 194);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 194);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_EncodeFSDefault(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 194, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 194, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy_UCS4 trace_ctx_Unicode_ReadChar(HPyContext *tctx, HPy h, HPy_ssize_t index)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 195);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 195);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 195);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_UCS4 res = HPyUnicode_ReadChar(uctx, h, index);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 195, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 195, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_DecodeASCII(HPyContext *tctx, const char *ascii, HPy_ssize_t size, const char *errors)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 196);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 196);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 196);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_DecodeASCII(uctx, ascii, size, errors);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 196, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 196, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_DecodeLatin1(HPyContext *tctx, const char *latin1, HPy_ssize_t size, const char *errors)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 197);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 197);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 197);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_DecodeLatin1(uctx, latin1, size, errors);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 197, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 197, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_FromEncodedObject(HPyContext *tctx, HPy obj, const char *encoding, const char *errors)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 255);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 255);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 255);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_FromEncodedObject(uctx, obj, encoding, errors);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 255, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 255, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Unicode_Substring(HPyContext *tctx, HPy str, HPy_ssize_t start, HPy_ssize_t end)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 256);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 256);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 256);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyUnicode_Substring(uctx, str, start, end);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 256, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 256, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_List_Check(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 198);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 198);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 198);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyList_Check(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 198, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 198, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_List_New(HPyContext *tctx, HPy_ssize_t len)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 199);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 199);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 199);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyList_New(uctx, len);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 199, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 199, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_List_Append(HPyContext *tctx, HPy h_list, HPy h_item)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 200);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 200);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 200);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyList_Append(uctx, h_list, h_item);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 200, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 200, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_List_Insert(HPyContext *tctx, HPy h_list, HPy_ssize_t index, HPy h_item)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 265);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 265);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 265);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyList_Insert(uctx, h_list, index, h_item);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 265, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 265, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Dict_Check(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 201);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 201);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 201);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyDict_Check(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 201, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 201, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Dict_New(HPyContext *tctx)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 202);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 202);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 202);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyDict_New(uctx);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 202, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 202, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Dict_Keys(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 257);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 257);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 257);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyDict_Keys(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 257, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 257, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Dict_Copy(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 258);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 258);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 258);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyDict_Copy(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 258, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 258, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+int trace_ctx_Dict_Next(HPyContext *tctx, HPy h, HPy_ssize_t *pos, HPy *key, HPy *value)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 285);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 285);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    int res = HPyDict_Next(uctx, h, pos, key, value);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 285, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Tuple_Check(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 203);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 203);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 203);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyTuple_Check(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 203, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 203, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Tuple_FromArray(HPyContext *tctx, const HPy items[], HPy_ssize_t n)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 204);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 204);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 204);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyTuple_FromArray(uctx, items, n);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 204, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 204, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Slice_New(HPyContext *tctx, HPy start, HPy stop, HPy step)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 272);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 272);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 272);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPySlice_New(uctx, start, stop, step);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 272, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 272, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Slice_Unpack(HPyContext *tctx, HPy slice, HPy_ssize_t *start, HPy_ssize_t *stop, HPy_ssize_t *step)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 259);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 259);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 259);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPySlice_Unpack(uctx, slice, start, stop, step);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 259, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 259, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Import_ImportModule(HPyContext *tctx, const char *utf8_name)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 205);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 205);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 205);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyImport_ImportModule(uctx, utf8_name);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 205, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 205, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_Capsule_New(HPyContext *tctx, void *pointer, const char *utf8_name, HPyCapsule_Destructor *destructor)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 244);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 244);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 244);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyCapsule_New(uctx, pointer, utf8_name, destructor);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 244, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 244, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void *trace_ctx_Capsule_Get(HPyContext *tctx, HPy capsule, _HPyCapsule_key key, const char *utf8_name)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 245);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 245);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 245);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     void * res = HPyCapsule_Get(uctx, capsule, key, utf8_name);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 245, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 245, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Capsule_IsValid(HPyContext *tctx, HPy capsule, const char *utf8_name)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 246);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 246);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 246);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyCapsule_IsValid(uctx, capsule, utf8_name);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 246, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 246, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Capsule_Set(HPyContext *tctx, HPy capsule, _HPyCapsule_key key, void *value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 247);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 247);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 247);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyCapsule_Set(uctx, capsule, key, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 247, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 247, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_FromPyObject(HPyContext *tctx, cpy_PyObject *obj)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 206);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 206);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 206);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_FromPyObject(uctx, obj);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 206, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 206, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 cpy_PyObject *trace_ctx_AsPyObject(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 207);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 207);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 207);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     cpy_PyObject * res = HPy_AsPyObject(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 207, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 207, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPyListBuilder trace_ctx_ListBuilder_New(HPyContext *tctx, HPy_ssize_t size)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 209);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 209);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 209);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyListBuilder res = HPyListBuilder_New(uctx, size);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 209, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 209, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_ListBuilder_Set(HPyContext *tctx, HPyListBuilder builder, HPy_ssize_t index, HPy h_item)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 210);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 210);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 210);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyListBuilder_Set(uctx, builder, index, h_item);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 210, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 210, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_ListBuilder_Build(HPyContext *tctx, HPyListBuilder builder)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 211);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 211);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 211);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyListBuilder_Build(uctx, builder);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 211, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 211, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_ListBuilder_Cancel(HPyContext *tctx, HPyListBuilder builder)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 212);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 212);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 212);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyListBuilder_Cancel(uctx, builder);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 212, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 212, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPyTupleBuilder trace_ctx_TupleBuilder_New(HPyContext *tctx, HPy_ssize_t size)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 213);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 213);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 213);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyTupleBuilder res = HPyTupleBuilder_New(uctx, size);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 213, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 213, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_TupleBuilder_Set(HPyContext *tctx, HPyTupleBuilder builder, HPy_ssize_t index, HPy h_item)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 214);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 214);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 214);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyTupleBuilder_Set(uctx, builder, index, h_item);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 214, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 214, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_TupleBuilder_Build(HPyContext *tctx, HPyTupleBuilder builder)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 215);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 215);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 215);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyTupleBuilder_Build(uctx, builder);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 215, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 215, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_TupleBuilder_Cancel(HPyContext *tctx, HPyTupleBuilder builder)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 216);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 216);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 216);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyTupleBuilder_Cancel(uctx, builder);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 216, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 216, timed, r0, r1, &_ts_start, &_ts_end);
+}
+
+HPyDictBuilder trace_ctx_DictBuilder_New(HPyContext *tctx, HPy_ssize_t size)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 286);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 286);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPyDictBuilder res = HPyDictBuilder_New(uctx, size);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 286, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+int trace_ctx_DictBuilder_Set(HPyContext *tctx, HPyDictBuilder builder, HPy h_key, HPy h_value)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 287);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 287);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    int res = HPyDictBuilder_Set(uctx, builder, h_key, h_value);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 287, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+int trace_ctx_DictBuilder_Set_s(HPyContext *tctx, HPyDictBuilder builder, const char *utf8_key, HPy h_value)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 288);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 288);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    int res = HPyDictBuilder_Set_s(uctx, builder, utf8_key, h_value);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 288, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+HPy trace_ctx_DictBuilder_Build(HPyContext *tctx, HPyDictBuilder builder)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 289);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 289);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPy res = HPyDictBuilder_Build(uctx, builder);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 289, timed, r0, r1, &_ts_start, &_ts_end);
+    return res;
+}
+
+void trace_ctx_DictBuilder_Cancel(HPyContext *tctx, HPyDictBuilder builder)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 290);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 290);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPyDictBuilder_Cancel(uctx, builder);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 290, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPyTracker trace_ctx_Tracker_New(HPyContext *tctx, HPy_ssize_t size)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 217);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 217);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 217);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyTracker res = HPyTracker_New(uctx, size);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 217, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 217, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_Tracker_Add(HPyContext *tctx, HPyTracker ht, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 218);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 218);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 218);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPyTracker_Add(uctx, ht, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 218, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 218, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Tracker_ForgetAll(HPyContext *tctx, HPyTracker ht)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 219);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 219);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 219);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyTracker_ForgetAll(uctx, ht);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 219, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 219, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 void trace_ctx_Tracker_Close(HPyContext *tctx, HPyTracker ht)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 220);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 220);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 220);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyTracker_Close(uctx, ht);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 220, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 220, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 void trace_ctx_Field_Store(HPyContext *tctx, HPy target_object, HPyField *target_field, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 221);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 221);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 221);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyField_Store(uctx, target_object, target_field, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 221, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 221, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_Field_Load(HPyContext *tctx, HPy source_object, HPyField source_field)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 222);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 222);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 222);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyField_Load(uctx, source_object, source_field);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 222, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 222, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
+void trace_ctx_Field_StoreMany(HPyContext *tctx, HPy target_object, HPyField **target_fields, const HPy *hs, HPy_ssize_t n)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 276);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 276);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPyField_StoreMany(uctx, target_object, target_fields, hs, n);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 276, timed, r0, r1, &_ts_start, &_ts_end);
+}
+
+void trace_ctx_Field_LoadMany(HPyContext *tctx, HPy source_object, HPyField **source_fields, HPy *out, HPy_ssize_t n)
+{
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 277);
+    HPyContext *uctx = shard->info->uctx;
+    _HPyTime_t _ts_start, _ts_end;
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 277);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
+    HPyField_LoadMany(uctx, source_object, source_fields, out, n);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 277, timed, r0, r1, &_ts_start, &_ts_end);
+}
+
 void trace_ctx_ReenterPythonExecution(HPyContext *tctx, HPyThreadState state)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 223);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 223);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 223);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy_ReenterPythonExecution(uctx, state);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 223, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 223, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPyThreadState trace_ctx_LeavePythonExecution(HPyContext *tctx)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 224);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 224);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 224);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyThreadState res = HPy_LeavePythonExecution(uctx);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 224, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 224, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Global_Store(HPyContext *tctx, HPyGlobal *global, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 225);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 225);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 225);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPyGlobal_Store(uctx, global, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 225, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 225, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_Global_Load(HPyContext *tctx, HPyGlobal global)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 226);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 226);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 226);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyGlobal_Load(uctx, global);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 226, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 226, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 void trace_ctx_Dump(HPyContext *tctx, HPy h)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 227);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 227);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 227);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     _HPy_Dump(uctx, h);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 227, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 227, timed, r0, r1, &_ts_start, &_ts_end);
 }
 
 HPy trace_ctx_Compile_s(HPyContext *tctx, const char *utf8_source, const char *utf8_filename, HPy_SourceKind kind)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 248);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 248);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 248);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_Compile_s(uctx, utf8_source, utf8_filename, kind);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 248, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 248, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_EvalCode(HPyContext *tctx, HPy code, HPy globals, HPy locals)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 249);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 249);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 249);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPy_EvalCode(uctx, code, globals, locals);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 249, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 249, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_ContextVar_New(HPyContext *tctx, const char *name, HPy default_value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 250);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 250);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 250);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyContextVar_New(uctx, name, default_value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 250, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 250, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int32_t trace_ctx_ContextVar_Get(HPyContext *tctx, HPy context_var, HPy default_value, HPy *result)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 251);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 251);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 251);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int32_t res = HPyContextVar_Get(uctx, context_var, default_value, result);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 251, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 251, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 HPy trace_ctx_ContextVar_Set(HPyContext *tctx, HPy context_var, HPy value)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 252);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 252);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 252);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     HPy res = HPyContextVar_Set(uctx, context_var, value);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 252, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 252, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
 int trace_ctx_SetCallFunction(HPyContext *tctx, HPy h, HPyCallFunction *func)
 {
-    HPyTraceInfo *info = hpy_trace_on_enter(tctx, 260);
-    HPyContext *uctx = info->uctx;
+    HPyTraceShard *shard = hpy_trace_on_enter(tctx, 260);
+    HPyContext *uctx = shard->info->uctx;
     _HPyTime_t _ts_start, _ts_end;
-    _HPyClockStatus_t r0, r1;
-    r0 = get_monotonic_clock(&_ts_start);
+    _HPyClockStatus_t r0 = 0, r1 = 0;
+    bool timed = hpy_trace_should_time(shard, 260);
+    if (timed)
+        r0 = get_monotonic_clock(&_ts_start);
     int res = HPy_SetCallFunction(uctx, h, func);
-    r1 = get_monotonic_clock(&_ts_end);
-    hpy_trace_on_exit(info, 260, r0, r1, &_ts_start, &_ts_end);
+    if (timed)
+        r1 = get_monotonic_clock(&_ts_end);
+    hpy_trace_on_exit(shard, 260, timed, r0, r1, &_ts_start, &_ts_end);
     return res;
 }
 
@@ -13,9 +13,16 @@
 
   If you call hpy_trace_get_ctx twice on the same uctx, you get the same
   result.
+
+  hpy_trace_get_module_ctx returns a copy of the tctx which is meant to be
+  used by one extension module only: the API calls done through it are also
+  counted separately for that module. The settings (e.g. the trace functions)
+  are shared with the tctx. Calling it twice with the same module name
+  returns the same context.
 */
 
 HPyContext * hpy_trace_get_ctx(HPyContext *uctx);
+HPyContext * hpy_trace_get_module_ctx(HPyContext *uctx, const char *name);
 int hpy_trace_ctx_init(HPyContext *tctx, HPyContext *uctx);
 int hpy_trace_ctx_free(HPyContext *tctx);
 int hpy_trace_get_nfunc(void);
@@ -39,4 +46,10 @@ extern "C"
 HPy_EXPORTED_SYMBOL
 void HPyInitGlobalContext__trace(HPyContext *ctx);
 
+#ifdef ___cplusplus
+extern "C"
+#endif
+HPy_EXPORTED_SYMBOL
+void HPyInitDirectCalls__trace(const _HPyFunc_DirectCallTable *table);
+
 #endif /* HPY_TRACE_H */
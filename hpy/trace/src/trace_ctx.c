@@ -1,3 +1,4 @@
+#include <string.h>
 #include "trace_internal.h"
 #include "autogen_trace_ctx_init.h"
 
@@ -31,6 +32,14 @@ int hpy_trace_ctx_init(HPyContext *tctx, HPyContext *uctx)
     clock_getres(CLOCK_MONOTONIC_RAW, &info->counter_freq);
 #endif
     trace_ctx_init_info(info, uctx);
+    info->main = info;
+    info->next_module = NULL;
+    info->module_name = NULL;
+    info->module_ctx = NULL;
+    info->module_id = 0;
+    info->n_modules = 0;
+    info->event_buffer = NULL;
+    info->retired_event_buffers = NULL;
     tctx->_private = info;
     trace_ctx_init_fields(tctx, uctx);
     return 0;
@@ -38,7 +47,10 @@ int hpy_trace_ctx_init(HPyContext *tctx, HPyContext *uctx)
 
 int hpy_trace_ctx_free(HPyContext *tctx)
 {
-    trace_ctx_free_info(get_info(tctx));
+    HPyTraceInfo *info = get_info(tctx);
+    if (info->main == info)
+        hpy_trace_free_event_buffers(info);
+    trace_ctx_free_info(info);
     return 0;
 }
 
@@ -54,6 +66,45 @@ HPyContext * hpy_trace_get_ctx(HPyContext *uctx)
     return tctx;
 }
 
+HPyContext * hpy_trace_get_module_ctx(HPyContext *uctx, const char *name)
+{
+    HPyContext *tctx = hpy_trace_get_ctx(uctx);
+    if (tctx == NULL)
+        return NULL;
+    HPyTraceInfo *main = get_info(tctx);
+    HPyTraceInfo *last = main;
+    for (HPyTraceInfo *m = main->next_module; m != NULL; m = m->next_module) {
+        if (strcmp(m->module_name, name) == 0)
+            return m->module_ctx;
+        last = m;
+    }
+    // XXX: like the global info, the module contexts are never freed
+    HPyContext *mctx = malloc(sizeof(struct _HPyContext_s));
+    HPyTraceInfo *info = malloc(sizeof(HPyTraceInfo));
+    char *module_name = malloc(strlen(name) + 1);
+    if (mctx == NULL || info == NULL || module_name == NULL) {
+        free(mctx);
+        free(info);
+        free(module_name);
+        HPyErr_NoMemory(uctx);
+        return NULL;
+    }
+    strcpy(module_name, name);
+    *mctx = *tctx;
+    trace_ctx_init_info(info, uctx);
+    info->counter_freq = main->counter_freq;
+    info->main = main;
+    info->next_module = NULL;
+    info->module_name = module_name;
+    info->module_ctx = mctx;
+    info->module_id = ++main->n_modules;
+    info->event_buffer = NULL;
+    info->retired_event_buffers = NULL;
+    mctx->_private = info;
+    last->next_module = info;
+    return mctx;
+}
+
 void hpy_trace_set_ctx(HPyContext *tctx)
 {
     g_trace_ctx = *tctx;
@@ -97,23 +148,63 @@ update_duration(_HPyTime_t *res, _HPyTime_t *start, _HPyTime_t *end)
 #endif
 }
 
-HPyTraceInfo *hpy_trace_on_enter(HPyContext *tctx, int id)
+/* The shards of the current thread, indexed by module_id. Since there is
+   only one global trace info (see hpy_trace_ctx_init), the module ids are
+   unique. The array itself is never freed, but it is small: the counters
+   are owned by the infos. */
+static HPY_TRACE_THREAD_LOCAL HPyTraceShard **tl_shards = NULL;
+static HPY_TRACE_THREAD_LOCAL uint32_t tl_n_shards = 0;
+
+static HPyTraceShard *new_thread_shard(HPyTraceInfo *info)
+{
+    uint32_t i = info->module_id;
+    if (i >= tl_n_shards) {
+        uint32_t n = i + 8;
+        HPyTraceShard **a = realloc(tl_shards, n * sizeof(HPyTraceShard *));
+        if (a == NULL)
+            HPy_FatalError(info->uctx, "out of memory in hpy_trace_on_enter");
+        memset(a + tl_n_shards, 0, (n - tl_n_shards) * sizeof(HPyTraceShard *));
+        tl_shards = a;
+        tl_n_shards = n;
+    }
+    HPyTraceShard *shard = trace_ctx_new_shard(info);
+    if (shard == NULL)
+        HPy_FatalError(info->uctx, "out of memory in hpy_trace_on_enter");
+    // lock-free push: other threads may be adding their shard concurrently
+    do {
+        shard->next = hpy_trace_first_shard(info);
+    } while (!hpy_trace_atomic_cas_ptr((void **)&info->shards, shard->next,
+                                       shard));
+    tl_shards[i] = shard;
+    return shard;
+}
+
+static inline HPyTraceShard *get_thread_shard(HPyTraceInfo *info)
+{
+    uint32_t i = info->module_id;
+    if (i < tl_n_shards && tl_shards[i] != NULL)
+        return tl_shards[i];
+    return new_thread_shard(info);
+}
+
+HPyTraceShard *hpy_trace_on_enter(HPyContext *tctx, int id)
 {
     HPyTraceInfo *tctx_info = get_info(tctx);
     HPyContext *uctx = tctx_info->uctx;
     HPy args, res;
-    tctx_info->call_counts[id]++;
-    if(!HPy_IsNull(tctx_info->on_enter_func)) {
+    HPyTraceShard *shard = get_thread_shard(tctx_info);
+    shard->call_counts[id]++;
+    if(!HPy_IsNull(tctx_info->main->on_enter_func)) {
         args = create_trace_func_args(uctx, id);
         res = HPy_CallTupleDict(
-                uctx, tctx_info->on_enter_func, args, HPy_NULL);
+                uctx, tctx_info->main->on_enter_func, args, HPy_NULL);
         HPy_Close(uctx, args);
         if (HPy_IsNull(res)) {
             HPy_FatalError(uctx,
                     "error when executing on-enter trace function");
         }
     }
-    return tctx_info;
+    return shard;
 }
 
 #ifdef _WIN32
@@ -122,21 +213,36 @@ HPyTraceInfo *hpy_trace_on_enter(HPyContext *tctx, int id)
 #define CLOCK_FAILED(_R0, _R1) ((_R0) + (_R1))
 #endif
 
-void hpy_trace_on_exit(HPyTraceInfo *info, int id, _HPyClockStatus_t r0,
-        _HPyClockStatus_t r1, _HPyTime_t *_ts_start, _HPyTime_t *_ts_end)
+void hpy_trace_on_exit(HPyTraceShard *shard, int id, bool timed,
+        _HPyClockStatus_t r0, _HPyClockStatus_t r1, _HPyTime_t *_ts_start,
+        _HPyTime_t *_ts_end)
 {
+    HPyTraceInfo *info = shard->info;
     HPyContext *uctx = info->uctx;
     HPy args, res;
-    if (CLOCK_FAILED(r0, r1))
-    {
-        printf("Could not get monotonic clock in %s\n", hpy_trace_get_func_name(id));
-        fflush(stdout);
-        HPy_FatalError(uctx, "could not get monotonic clock123");
+    if (timed) {
+        if (CLOCK_FAILED(r0, r1))
+        {
+            printf("Could not get monotonic clock in %s\n", hpy_trace_get_func_name(id));
+            fflush(stdout);
+            HPy_FatalError(uctx, "could not get monotonic clock123");
+        }
+        update_duration(&shard->durations[id], _ts_start, _ts_end);
+        shard->timed_counts[id]++;
+        uint64_t ns = hpy_trace_time_to_ns(info, _ts_end) -
+                      hpy_trace_time_to_ns(info, _ts_start);
+        shard->histograms[(size_t)id * HPY_TRACE_HIST_NBUCKETS +
+                          hpy_trace_hist_bucket(ns)]++;
+        if (ns > shard->max_durations[id])
+            shard->max_durations[id] = ns;
+        HPyTraceEventBuffer *buf = (HPyTraceEventBuffer *)
+            hpy_trace_atomic_load_ptr((void **)&info->main->event_buffer);
+        if (buf != NULL)
+            hpy_trace_record_event(info, buf, id, _ts_start, _ts_end);
     }
-    update_duration(&info->durations[id], _ts_start, _ts_end);
-    if(!HPy_IsNull(info->on_exit_func)) {
+    if(!HPy_IsNull(info->main->on_exit_func)) {
         args = create_trace_func_args(uctx, id);
-        res = HPy_CallTupleDict(uctx, info->on_exit_func, args, HPy_NULL);
+        res = HPy_CallTupleDict(uctx, info->main->on_exit_func, args, HPy_NULL);
         HPy_Close(uctx, args);
         if (HPy_IsNull(res)) {
             HPy_FatalError(uctx,
@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <string.h>
+#include "trace_internal.h"
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+/* The event buffer is a multi-producer ring buffer: each writer claims a
+   slot by atomically incrementing 'head', so that recording an event never
+   takes a lock. When the buffer is full, the oldest events are overwritten.
+
+   Writers may run concurrently with hpy_trace_set_event_buffer_size and
+   hpy_trace_dump_events, e.g. in threads which run HPy code without the GIL
+   or after HPy_LeavePythonExecution. So, a writer loads the current buffer
+   only once and a new buffer is published atomically. A replaced buffer is
+   not freed, since a writer may still be using it: it is moved to the list
+   of retired buffers, which are freed by hpy_trace_ctx_free, when no HPy
+   code can run anymore. hpy_trace_dump_events may see events which are
+   being written: they are not synchronized, but the memory stays valid.
+
+   hpy_trace_set_event_buffer_size and hpy_trace_dump_events themselves must
+   not run concurrently with each other: they are only called from
+   hpy.trace, with the GIL held. */
+
+static inline uint64_t current_thread_id(void)
+{
+#ifdef _WIN32
+    return (uint64_t)GetCurrentThreadId();
+#else
+    return (uint64_t)(uintptr_t)pthread_self();
+#endif
+}
+
+void hpy_trace_record_event(HPyTraceInfo *info, HPyTraceEventBuffer *buf,
+        int id, _HPyTime_t *start, _HPyTime_t *end)
+{
+    uint64_t start_ns = hpy_trace_time_to_ns(info, start);
+    HPyTraceEvent *ev = &buf->events[hpy_trace_atomic_fetch_inc(&buf->head) & buf->mask];
+    ev->start_ns = start_ns;
+    ev->duration_ns = hpy_trace_time_to_ns(info, end) - start_ns;
+    ev->thread_id = current_thread_id();
+    ev->func_id = (uint32_t)id;
+    ev->module_id = info->module_id;
+}
+
+/* Replace the event buffer of 'main' with a new empty one which can hold
+   'size' events, rounded up to a power of 2. If 'size' is 0, stop recording
+   events. */
+int hpy_trace_set_event_buffer_size(HPyTraceInfo *main, uint64_t size)
+{
+    assert(main->main == main);
+    HPyTraceEventBuffer *old = main->event_buffer;
+    HPyTraceEventBuffer *buf = NULL;
+    if (size > 0) {
+        uint64_t capacity = 1;
+        while (capacity < size)
+            capacity <<= 1;
+        if (capacity > SIZE_MAX / sizeof(HPyTraceEvent))
+            return -1;
+        buf = malloc(sizeof(HPyTraceEventBuffer));
+        if (buf == NULL)
+            return -1;
+        buf->events = malloc(capacity * sizeof(HPyTraceEvent));
+        if (buf->events == NULL) {
+            free(buf);
+            return -1;
+        }
+        buf->mask = capacity - 1;
+        buf->head = 0;
+        buf->next_retired = NULL;
+    }
+    hpy_trace_atomic_store_ptr((void **)&main->event_buffer, buf);
+    if (old != NULL) {
+        // other threads may still be writing to it, see above
+        old->next_retired = main->retired_event_buffers;
+        main->retired_event_buffers = old;
+    }
+    return 0;
+}
+
+uint64_t hpy_trace_get_event_buffer_size(HPyTraceInfo *main)
+{
+    HPyTraceEventBuffer *buf = (HPyTraceEventBuffer *)
+        hpy_trace_atomic_load_ptr((void **)&main->event_buffer);
+    return buf == NULL ? 0 : buf->mask + 1;
+}
+
+/* Free the current and the retired event buffers. This must only be called
+   when no other thread can record events anymore. */
+void hpy_trace_free_event_buffers(HPyTraceInfo *main)
+{
+    assert(main->main == main);
+    HPyTraceEventBuffer *buf = main->event_buffer;
+    main->event_buffer = NULL;
+    if (buf != NULL) {
+        buf->next_retired = main->retired_event_buffers;
+        main->retired_event_buffers = buf;
+    }
+    while (main->retired_event_buffers != NULL) {
+        buf = main->retired_event_buffers;
+        main->retired_event_buffers = buf->next_retired;
+        free(buf->events);
+        free(buf);
+    }
+}
+
+static int write_string(FILE *f, const char *s)
+{
+    uint32_t n = (uint32_t)strlen(s);
+    return fwrite(&n, sizeof(n), 1, f) == 1 &&
+           fwrite(s, 1, n, f) == n;
+}
+
+/* Write the recorded events to 'path', using the format described in
+   trace_internal.h. Return the number of events written, or -1 in case of
+   I/O errors (with errno set). */
+int64_t hpy_trace_dump_events(HPyTraceInfo *main, const char *path)
+{
+    HPyTraceEventBuffer *buf = (HPyTraceEventBuffer *)
+        hpy_trace_atomic_load_ptr((void **)&main->event_buffer);
+    uint64_t head = buf == NULL ? 0 : hpy_trace_atomic_load_u64(&buf->head);
+    uint64_t capacity = buf == NULL ? 0 : buf->mask + 1;
+    uint64_t first = head > capacity ? head - capacity : 0;
+    /* the function ids are context indices, so there are more of them than
+       hpy_trace_get_nfunc(): write the whole table, including the empty
+       names of the context handles */
+    uint32_t nfunc = 0;
+    while (hpy_trace_get_func_name(nfunc) != NULL)
+        nfunc++;
+
+    HPyTraceEventFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, HPY_TRACE_EVENT_FILE_MAGIC, sizeof(header.magic));
+    header.version = HPY_TRACE_EVENT_FILE_VERSION;
+    header.event_size = sizeof(HPyTraceEvent);
+    header.n_events = head - first;
+    header.n_dropped = first;
+    header.events_offset = sizeof(header);
+    header.strings_offset = sizeof(header) + header.n_events * sizeof(HPyTraceEvent);
+    header.n_funcs = nfunc;
+    header.n_modules = main->n_modules + 1;
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+        return -1;
+    int ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    /* the events are contiguous in the buffer, except when they wrap around */
+    for (uint64_t n = first; ok && n < head; ) {
+        uint64_t start = n & buf->mask;
+        uint64_t count = capacity - start;
+        if (count > head - n)
+            count = head - n;
+        ok = fwrite(&buf->events[start], sizeof(HPyTraceEvent), count, f) == count;
+        n += count;
+    }
+    for (uint32_t id = 0; ok && id < nfunc; id++)
+        ok = write_string(f, hpy_trace_get_func_name(id));
+    ok = ok && write_string(f, "");
+    for (HPyTraceInfo *m = main->next_module; ok && m != NULL; m = m->next_module)
+        ok = write_string(f, m->module_name);
+    if (fclose(f) != 0)
+        ok = 0;
+    return ok ? (int64_t)header.n_events : -1;
+}
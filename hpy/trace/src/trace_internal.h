@@ -19,6 +19,155 @@
 // frequency of nanosecond resolution
 #define FREQ_NSEC 1000000000L
 
+#ifdef _MSC_VER
+#define HPY_TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define HPY_TRACE_THREAD_LOCAL __thread
+#endif
+
+/* === atomic helpers === */
+
+static inline uint64_t hpy_trace_atomic_fetch_inc(uint64_t *p)
+{
+#ifdef _MSC_VER
+    return (uint64_t)InterlockedIncrement64((volatile LONG64 *)p) - 1;
+#else
+    return __atomic_fetch_add(p, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+/* Atomically replace '*p' with 'newval' if it is still 'oldval' */
+static inline bool hpy_trace_atomic_cas_ptr(void **p, void *oldval, void *newval)
+{
+#ifdef _MSC_VER
+    return InterlockedCompareExchangePointer((PVOID volatile *)p, newval,
+                                             oldval) == oldval;
+#else
+    return __atomic_compare_exchange_n(p, &oldval, newval, false,
+                                       __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+#endif
+}
+
+static inline void *hpy_trace_atomic_load_ptr(void **p)
+{
+#ifdef _MSC_VER
+    return InterlockedCompareExchangePointer((PVOID volatile *)p, NULL, NULL);
+#else
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void hpy_trace_atomic_store_ptr(void **p, void *val)
+{
+#ifdef _MSC_VER
+    (void)InterlockedExchangePointer((PVOID volatile *)p, val);
+#else
+    __atomic_store_n(p, val, __ATOMIC_RELEASE);
+#endif
+}
+
+static inline uint64_t hpy_trace_atomic_load_u64(uint64_t *p)
+{
+#ifdef _MSC_VER
+    return (uint64_t)InterlockedCompareExchange64((volatile LONG64 *)p, 0, 0);
+#else
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+#endif
+}
+
+/* === HPyTraceEventBuffer === */
+
+/* One timed call of an HPy API function. The events are stored in a ring
+   buffer and can be dumped to a file with the following layout (all integers
+   in native byte order):
+
+       HPyTraceEventFileHeader
+       HPyTraceEvent[n_events]   (at events_offset, oldest first)
+       n_funcs function names, then n_modules module names (at
+       strings_offset), each one as a uint32_t length followed by the bytes
+
+   'module_id' is 0 for calls which are not attributed to a module, and i for
+   the i-th module loaded in trace mode. See also hpy/trace/events.py. */
+typedef struct {
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    uint64_t thread_id;
+    uint32_t func_id;
+    uint32_t module_id;
+} HPyTraceEvent;
+
+#define HPY_TRACE_EVENT_FILE_MAGIC "HPYTRACE"
+#define HPY_TRACE_EVENT_FILE_VERSION 1
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t event_size;
+    uint64_t n_events;
+    uint64_t n_dropped;       // older events which have been overwritten
+    uint64_t events_offset;
+    uint64_t strings_offset;
+    uint32_t n_funcs;
+    uint32_t n_modules;
+} HPyTraceEventFileHeader;
+
+typedef struct _HPyTraceEventBuffer_s {
+    HPyTraceEvent *events;
+    uint64_t mask;       // capacity - 1; the capacity is a power of 2
+    uint64_t head;       // total number of events ever recorded
+    // next buffer in the list of retired buffers, see HPyTraceInfo
+    struct _HPyTraceEventBuffer_s *next_retired;
+} HPyTraceEventBuffer;
+
+/* === latency histograms === */
+
+/* For each HPy API function, every shard has a log-scaled histogram of the
+   durations of the timed calls. Like in HdrHistogram, each power of 2 is
+   split into 2**HPY_TRACE_HIST_SUB_BITS linear sub-buckets, so the width of
+   a bucket is at most 25% of its lower bound. Bucket 0 holds the calls
+   shorter than 2**HPY_TRACE_HIST_MIN_EXP ns (8 ns) and the last bucket the
+   ones of at least 2**HPY_TRACE_HIST_MAX_EXP ns (~1.07 s). */
+#define HPY_TRACE_HIST_SUB_BITS 2
+#define HPY_TRACE_HIST_MIN_EXP 3
+#define HPY_TRACE_HIST_MAX_EXP 30
+#define HPY_TRACE_HIST_NBUCKETS \
+    (((HPY_TRACE_HIST_MAX_EXP - HPY_TRACE_HIST_MIN_EXP) << HPY_TRACE_HIST_SUB_BITS) + 2)
+
+/* floor(log2(x)) for x > 0 */
+static inline uint32_t hpy_trace_log2(uint64_t x)
+{
+#ifdef _MSC_VER
+    unsigned long res;
+    _BitScanReverse64(&res, x);
+    return (uint32_t)res;
+#else
+    return 63 - (uint32_t)__builtin_clzll(x);
+#endif
+}
+
+static inline uint32_t hpy_trace_hist_bucket(uint64_t ns)
+{
+    if (ns < ((uint64_t)1 << HPY_TRACE_HIST_MIN_EXP))
+        return 0;
+    uint32_t e = hpy_trace_log2(ns);
+    if (e >= HPY_TRACE_HIST_MAX_EXP)
+        return HPY_TRACE_HIST_NBUCKETS - 1;
+    uint32_t sub = (uint32_t)(ns >> (e - HPY_TRACE_HIST_SUB_BITS)) &
+                   ((1 << HPY_TRACE_HIST_SUB_BITS) - 1);
+    return 1 + ((e - HPY_TRACE_HIST_MIN_EXP) << HPY_TRACE_HIST_SUB_BITS) + sub;
+}
+
+/* The smallest duration (in ns) which falls into bucket 'b' */
+static inline uint64_t hpy_trace_hist_lower_bound(uint32_t b)
+{
+    if (b == 0)
+        return 0;
+    b--;
+    uint32_t e = HPY_TRACE_HIST_MIN_EXP + (b >> HPY_TRACE_HIST_SUB_BITS);
+    uint64_t sub = b & ((1 << HPY_TRACE_HIST_SUB_BITS) - 1);
+    return ((uint64_t)1 << e) + (sub << (e - HPY_TRACE_HIST_SUB_BITS));
+}
+
 /* === HPyTraceInfo === */
 
 #ifdef _WIN32
@@ -29,23 +178,78 @@ typedef struct timespec _HPyTime_t;
 typedef int _HPyClockStatus_t;
 #endif
 
-typedef struct {
+typedef struct _HPyTraceInfo_s {
     long magic_number; // used just for sanity checks
     HPyContext *uctx;
+    /* The info of the global trace context holds the settings (trace
+       functions, sample period, ...) and the counters of the calls which are
+       not attributed to a module. Each module loaded in trace mode has its
+       own context and info (see hpy_trace_get_module_ctx) which only holds
+       the counters of that module; 'main' points to the global info. The
+       module infos are linked together through 'next_module', starting from
+       the global info. */
+    struct _HPyTraceInfo_s *main;
+    struct _HPyTraceInfo_s *next_module;
+    const char *module_name; // NULL for the global info
+    HPyContext *module_ctx;  // NULL for the global info
+    uint32_t module_id;      // 0 for the global info
+    uint32_t n_modules;      // only valid in the global info
     /* frequency of the used performance counter */
     _HPyTime_t counter_freq;
 #ifdef _WIN32
     /* to_ns = FREQ_NS / counter_freq  */
     int64_t to_ns;
 #endif
-    /* call count of the corresponding HPy API function */
-    uint64_t *call_counts;
-    /* durations spent in the corresponding HPy API function */
-    _HPyTime_t *durations;
+    /* The counters are split in one shard per thread, so that threads
+       calling HPy functions concurrently (without the GIL, or after
+       HPy_LeavePythonExecution) never write to the same counters. The
+       shards are created lazily (see hpy_trace_on_enter) and are never
+       freed before the info, so that the calls of terminated threads are
+       still counted. Use hpy_trace_first_shard to read the list. */
+    struct _HPyTraceShard_s *shards;
+    /* time only one call every 'sample_period' calls of each HPy API
+       function; the calls are counted anyway */
+    uint64_t sample_period;
+    /* if not NULL, record an event for each timed call; only used in the
+       global info. It is read with hpy_trace_atomic_load_ptr, since it can
+       be replaced while other threads are recording events. */
+    HPyTraceEventBuffer *event_buffer;
+    /* the buffers replaced by hpy_trace_set_event_buffer_size: a thread may
+       still be writing to them, so they are only freed by
+       hpy_trace_ctx_free */
+    HPyTraceEventBuffer *retired_event_buffers;
     HPy on_enter_func;
     HPy on_exit_func;
 } HPyTraceInfo;
 
+/* === HPyTraceShard === */
+
+/* The counters of one thread for one HPyTraceInfo */
+typedef struct _HPyTraceShard_s {
+    HPyTraceInfo *info;
+    struct _HPyTraceShard_s *next;  // next shard of the same info
+    /* call count of the corresponding HPy API function */
+    uint64_t *call_counts;
+    /* durations spent in the corresponding HPy API function; in sampling
+       mode, this only includes the timed calls */
+    _HPyTime_t *durations;
+    /* number of calls which have been timed and are included in
+       'durations'; it is equal to 'call_counts' if 'sample_period' is 1 */
+    uint64_t *timed_counts;
+    /* HPY_TRACE_HIST_NBUCKETS counters per HPy API function, see
+       hpy_trace_hist_bucket; only the timed calls are included */
+    uint64_t *histograms;
+    /* longest timed call of the corresponding HPy API function, in ns */
+    uint64_t *max_durations;
+} HPyTraceShard;
+
+/* The shards can be read by any thread while they are being updated; the
+   values read may be slightly behind the ones of the running threads. */
+static inline HPyTraceShard *hpy_trace_first_shard(HPyTraceInfo *info)
+{
+    return (HPyTraceShard *)hpy_trace_atomic_load_ptr((void **)&info->shards);
+}
+
 
 static inline HPyTraceInfo *get_info(HPyContext *tctx)
 {
@@ -65,8 +269,39 @@ static inline _HPyClockStatus_t get_monotonic_clock(_HPyTime_t *t)
 #endif
 }
 
-HPyTraceInfo *hpy_trace_on_enter(HPyContext *tctx, int id);
-void hpy_trace_on_exit(HPyTraceInfo *info, int id, _HPyClockStatus_t r0,
-        _HPyClockStatus_t r1, _HPyTime_t *_ts_start, _HPyTime_t *_ts_end);
+static inline uint64_t hpy_trace_time_to_ns(HPyTraceInfo *info,
+                                            const _HPyTime_t *t)
+{
+#ifdef _WIN32
+    /* split the computation to avoid overflowing for large counter values */
+    uint64_t q = (uint64_t)t->QuadPart;
+    uint64_t f = (uint64_t)info->counter_freq.QuadPart;
+    return (q / f) * FREQ_NSEC + (q % f) * FREQ_NSEC / f;
+#else
+    return (uint64_t)t->tv_sec * FREQ_NSEC + (uint64_t)t->tv_nsec;
+#endif
+}
+
+/* Decide if the current call of the HPy API function 'id' should be timed.
+   Must be called after 'hpy_trace_on_enter', which counts the call. Sampling
+   is done per function, such that every function gets the first and then
+   every N-th of its calls timed, independently of the others. */
+static inline bool hpy_trace_should_time(HPyTraceShard *shard, int id)
+{
+    uint64_t period = shard->info->main->sample_period;
+    return period <= 1 || (shard->call_counts[id] - 1) % period == 0;
+}
+
+HPyTraceShard *hpy_trace_on_enter(HPyContext *tctx, int id);
+void hpy_trace_on_exit(HPyTraceShard *shard, int id, bool timed,
+        _HPyClockStatus_t r0, _HPyClockStatus_t r1, _HPyTime_t *_ts_start,
+        _HPyTime_t *_ts_end);
+
+void hpy_trace_record_event(HPyTraceInfo *info, HPyTraceEventBuffer *buf,
+        int id, _HPyTime_t *start, _HPyTime_t *end);
+int hpy_trace_set_event_buffer_size(HPyTraceInfo *main, uint64_t size);
+uint64_t hpy_trace_get_event_buffer_size(HPyTraceInfo *main);
+void hpy_trace_free_event_buffers(HPyTraceInfo *main);
+int64_t hpy_trace_dump_events(HPyTraceInfo *main, const char *path);
 
 #endif /* HPY_TRACE_INTERNAL_H */
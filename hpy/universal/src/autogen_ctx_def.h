@@ -17,6 +17,8 @@ struct _HPyContext_s g_universal_ctx = {
     /* h_None & co. are initialized by init_universal_ctx() */
     .ctx_Dup = &ctx_Dup,
     .ctx_Close = &ctx_Close,
+    .ctx_CloseMany = &ctx_CloseMany,
+    .ctx_DupMany = &ctx_DupMany,
     .ctx_Long_FromInt32_t = &ctx_Long_FromInt32_t,
     .ctx_Long_FromUInt32_t = &ctx_Long_FromUInt32_t,
     .ctx_Long_FromInt64_t = &ctx_Long_FromInt64_t,
@@ -76,9 +78,11 @@ struct _HPyContext_s g_universal_ctx = {
     .ctx_CallTupleDict = &ctx_CallTupleDict,
     .ctx_Call = &ctx_Call,
     .ctx_CallMethod = &ctx_CallMethod,
+    .ctx_CallMethodCached = &ctx_CallMethodCached,
     .ctx_GetIter = &ctx_GetIter,
     .ctx_Iter_Next = &ctx_Iter_Next,
     .ctx_Iter_Check = &ctx_Iter_Check,
+    .ctx_Iter_NextBatch = &ctx_Iter_NextBatch,
     .ctx_FatalError = &ctx_FatalError,
     .ctx_Err_SetString = &ctx_Err_SetString,
     .ctx_Err_SetObject = &ctx_Err_SetObject,
@@ -130,6 +134,7 @@ struct _HPyContext_s g_universal_ctx = {
     .ctx_AsStruct_Dict = &ctx_AsStruct_Dict,
     .ctx_Type_GetBuiltinShape = &ctx_Type_GetBuiltinShape,
     .ctx_New = &ctx_New,
+    .ctx_StructSequence_New = &ctx_StructSequence_New,
     .ctx_Repr = &ctx_Repr,
     .ctx_Str = &ctx_Str,
     .ctx_ASCII = &ctx_ASCII,
@@ -137,6 +142,10 @@ struct _HPyContext_s g_universal_ctx = {
     .ctx_RichCompare = &ctx_RichCompare,
     .ctx_RichCompareBool = &ctx_RichCompareBool,
     .ctx_Hash = &ctx_Hash,
+    .ctx_GetBuffer = &ctx_GetBuffer,
+    .ctx_Buffer_Release = &ctx_Buffer_Release,
+    .ctx_Buffer_IsContiguous = &ctx_Buffer_IsContiguous,
+    .ctx_Buffer_ToContiguous = &ctx_Buffer_ToContiguous,
     .ctx_Bytes_Check = &ctx_Bytes_Check,
     .ctx_Bytes_Size = &ctx_Bytes_Size,
     .ctx_Bytes_GET_SIZE = &ctx_Bytes_GET_SIZE,
@@ -167,6 +176,7 @@ struct _HPyContext_s g_universal_ctx = {
     .ctx_Dict_New = &ctx_Dict_New,
     .ctx_Dict_Keys = &ctx_Dict_Keys,
     .ctx_Dict_Copy = &ctx_Dict_Copy,
+    .ctx_Dict_Next = &ctx_Dict_Next,
     .ctx_Tuple_Check = &ctx_Tuple_Check,
     .ctx_Tuple_FromArray = &ctx_Tuple_FromArray,
     .ctx_Slice_New = &ctx_Slice_New,
@@ -187,12 +197,20 @@ struct _HPyContext_s g_universal_ctx = {
     .ctx_TupleBuilder_Set = &ctx_TupleBuilder_Set,
     .ctx_TupleBuilder_Build = &ctx_TupleBuilder_Build,
     .ctx_TupleBuilder_Cancel = &ctx_TupleBuilder_Cancel,
+    .ctx_DictBuilder_New = &ctx_DictBuilder_New,
+    .ctx_DictBuilder_Set = &ctx_DictBuilder_Set,
+    .ctx_DictBuilder_Set_s = &ctx_DictBuilder_Set_s,
+    .ctx_DictBuilder_Build = &ctx_DictBuilder_Build,
+    .ctx_DictBuilder_Cancel = &ctx_DictBuilder_Cancel,
     .ctx_Tracker_New = &ctx_Tracker_New,
     .ctx_Tracker_Add = &ctx_Tracker_Add,
     .ctx_Tracker_ForgetAll = &ctx_Tracker_ForgetAll,
     .ctx_Tracker_Close = &ctx_Tracker_Close,
     .ctx_Field_Store = &ctx_Field_Store,
     .ctx_Field_Load = &ctx_Field_Load,
+    .ctx_Field_StoreMany = &ctx_Field_StoreMany,
+    .ctx_Field_LoadMany = &ctx_Field_LoadMany,
+    .ctx_Field_WriteBarrier = NULL,
     .ctx_ReenterPythonExecution = &ctx_ReenterPythonExecution,
     .ctx_LeavePythonExecution = &ctx_LeavePythonExecution,
     .ctx_Global_Store = &ctx_Global_Store,
@@ -34,103 +34,239 @@ static void _buffer_py2h(HPyContext *ctx, const Py_buffer *src, HPy_buffer *dest
     dest->internal = src->internal;
 }
 
-HPyAPI_IMPL void
-ctx_CallRealFunctionFromTrampoline(HPyContext *ctx, HPyFunc_Signature sig,
-                                   HPyCFunction func, void *args)
+/* Most calls pass only a few arguments: for those, the handles are stored in
+   a fixed-size array on the stack of the caller and we don't need alloca(). */
+#define SMALL_NARGS 4
+
+/* Convert an array of (non-NULL) arguments into handles. The common small
+   cases are unrolled. */
+static inline void
+_py2h_args(HPy *dst, PyObject *const *src, size_t n)
 {
-    switch (sig) {
-    case HPyFunc_VARARGS: {
-        HPyFunc_varargs f = (HPyFunc_varargs)func;
-        _HPyFunc_args_VARARGS *a = (_HPyFunc_args_VARARGS*)args;
-        HPy *h_args = (HPy *)alloca(a->nargs * sizeof(HPy));
-        for (HPy_ssize_t i = 0; i < a->nargs; i++) {
-            h_args[i] = _py2h(a->args[i]);
-        }
-        a->result = _h2py(f(ctx, _py2h(a->self), h_args, a->nargs));
-        return;
-    }
-    case HPyFunc_KEYWORDS: {
-        HPyFunc_keywords f = (HPyFunc_keywords)func;
-        _HPyFunc_args_KEYWORDS *a = (_HPyFunc_args_KEYWORDS*)args;
-        size_t n_kwnames = a->kwnames != NULL ? PyTuple_GET_SIZE(a->kwnames) : 0;
-        size_t nargs = PyVectorcall_NARGS(a->nargsf);
-        size_t nargs_with_kw = nargs + n_kwnames;
-        HPy *h_args = (HPy *)alloca(nargs_with_kw * sizeof(HPy));
-        for (size_t i = 0; i < nargs_with_kw; i++) {
-            h_args[i] = _py2h(a->args[i]);
-        }
-        a->result = _h2py(f(ctx, _py2h(a->self), h_args, nargs, _py2h(a->kwnames)));
-        return;
-    }
-    case HPyFunc_INITPROC: {
-        HPyFunc_initproc f = (HPyFunc_initproc)func;
-        _HPyFunc_args_INITPROC *a = (_HPyFunc_args_INITPROC*)args;
-        Py_ssize_t nargs = PyTuple_GET_SIZE(a->args);
-        HPy *h_args = (HPy *)alloca(nargs * sizeof(HPy));
-        for (Py_ssize_t i = 0; i < nargs; i++) {
-            h_args[i] = _py2h(PyTuple_GET_ITEM(a->args, i));
-        }
-        a->result = f(ctx, _py2h(a->self), h_args, nargs, _py2h(a->kw));
-        return;
-    }
-    case HPyFunc_NEWFUNC: {
-        HPyFunc_newfunc f = (HPyFunc_newfunc)func;
-        _HPyFunc_args_NEWFUNC *a = (_HPyFunc_args_NEWFUNC*)args;
-        Py_ssize_t nargs = PyTuple_GET_SIZE(a->args);
-        HPy *h_args = (HPy *)alloca(nargs * sizeof(HPy));
-        for (Py_ssize_t i = 0; i < nargs; i++) {
-            h_args[i] = _py2h(PyTuple_GET_ITEM(a->args, i));
-        }
-        a->result = _h2py(f(ctx, _py2h(a->self), h_args, nargs, _py2h(a->kw)));
-        return;
-    }
-    case HPyFunc_GETBUFFERPROC: {
-        HPyFunc_getbufferproc f = (HPyFunc_getbufferproc)func;
-        _HPyFunc_args_GETBUFFERPROC *a = (_HPyFunc_args_GETBUFFERPROC*)args;
-        HPy_buffer hbuf;
-        a->result = f(ctx, _py2h(a->self), &hbuf, a->flags);
-        if (a->result < 0) {
-            a->view->obj = NULL;
-            return;
+    switch (n) {
+    case 4: dst[3] = _py2h_nonnull(src[3]); /* fall through */
+    case 3: dst[2] = _py2h_nonnull(src[2]); /* fall through */
+    case 2: dst[1] = _py2h_nonnull(src[1]); /* fall through */
+    case 1: dst[0] = _py2h_nonnull(src[0]); /* fall through */
+    case 0: return;
+    default:
+        for (size_t i = 0; i < n; i++) {
+            dst[i] = _py2h_nonnull(src[i]);
         }
-        _buffer_h2py(ctx, &hbuf, a->view);
-        HPy_Close(ctx, hbuf.obj);
-        return;
     }
-    case HPyFunc_RELEASEBUFFERPROC: {
-        HPyFunc_releasebufferproc f = (HPyFunc_releasebufferproc)func;
-        _HPyFunc_args_RELEASEBUFFERPROC *a = (_HPyFunc_args_RELEASEBUFFERPROC*)args;
-        HPy_buffer hbuf;
-        _buffer_py2h(ctx, a->view, &hbuf);
-        f(ctx, _py2h(a->self), &hbuf);
-        // XXX: copy back from hbuf?
-        HPy_Close(ctx, hbuf.obj);
-        return;
-    }
-    case HPyFunc_TRAVERSEPROC: {
-        HPyFunc_traverseproc f = (HPyFunc_traverseproc)func;
-        _HPyFunc_args_TRAVERSEPROC *a = (_HPyFunc_args_TRAVERSEPROC*)args;
-        a->result = call_traverseproc_from_trampoline(f, a->self,
-                                                      a->visit, a->arg);
+}
+
+#define ARGS_BUFFER(small, n) \
+    ((size_t)(n) <= SMALL_NARGS ? (small) : (HPy *)alloca((n) * sizeof(HPy)))
+
+/* The per-signature implementations of ctx_CallRealFunctionFromTrampoline.
+   They are also used directly by the trampolines of the modules which
+   support it, see get_direct_call_table() below. */
+
+static void
+call_VARARGS(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_varargs f = (HPyFunc_varargs)func;
+    _HPyFunc_args_VARARGS *a = (_HPyFunc_args_VARARGS*)args;
+    HPy small_args[SMALL_NARGS];
+    HPy *h_args = ARGS_BUFFER(small_args, a->nargs);
+    _py2h_args(h_args, a->args, a->nargs);
+    a->result = _h2py(f(ctx, _py2h(a->self), h_args, a->nargs));
+}
+
+static void
+call_KEYWORDS(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_keywords f = (HPyFunc_keywords)func;
+    _HPyFunc_args_KEYWORDS *a = (_HPyFunc_args_KEYWORDS*)args;
+    size_t n_kwnames = a->kwnames != NULL ? PyTuple_GET_SIZE(a->kwnames) : 0;
+    size_t nargs = PyVectorcall_NARGS(a->nargsf);
+    size_t nargs_with_kw = nargs + n_kwnames;
+    HPy small_args[SMALL_NARGS];
+    HPy *h_args = ARGS_BUFFER(small_args, nargs_with_kw);
+    _py2h_args(h_args, a->args, nargs_with_kw);
+    a->result = _h2py(f(ctx, _py2h(a->self), h_args, nargs, _py2h(a->kwnames)));
+}
+
+static void
+call_KWTABLE(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_kwtable f = (HPyFunc_kwtable)func;
+    _HPyFunc_args_KWTABLE *a = (_HPyFunc_args_KWTABLE*)args;
+    size_t n = (size_t)a->kwtable->nparams;
+    PyObject *small_params[SMALL_NARGS];
+    PyObject **params = n <= SMALL_NARGS ? small_params :
+                        (PyObject **)alloca(n * sizeof(PyObject *));
+    if (_HPyKwTable_PlaceArgs(a->kwtable, a->args, a->nargsf, a->kwnames,
+                              params) < 0) {
+        a->result = NULL;
         return;
     }
-    case HPyFunc_CAPSULE_DESTRUCTOR: {
-        HPyFunc_Capsule_Destructor f = (HPyFunc_Capsule_Destructor)func;
-        PyObject *capsule = (PyObject *)args;
-        const char *name = PyCapsule_GetName(capsule);
-        f(name, PyCapsule_GetPointer(capsule, name),
-                PyCapsule_GetContext(capsule));
+    HPy small_args[SMALL_NARGS];
+    HPy *h_args = ARGS_BUFFER(small_args, n);
+    for (size_t i = 0; i < n; i++)
+        h_args[i] = _py2h(params[i]);
+    a->result = _h2py(f(ctx, _py2h(a->self), h_args, n));
+}
+
+static void
+call_INITPROC(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_initproc f = (HPyFunc_initproc)func;
+    _HPyFunc_args_INITPROC *a = (_HPyFunc_args_INITPROC*)args;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(a->args);
+    HPy small_args[SMALL_NARGS];
+    HPy *h_args = ARGS_BUFFER(small_args, nargs);
+    _py2h_args(h_args, &PyTuple_GET_ITEM(a->args, 0), nargs);
+    a->result = f(ctx, _py2h(a->self), h_args, nargs, _py2h(a->kw));
+}
+
+static void
+call_NEWFUNC(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_newfunc f = (HPyFunc_newfunc)func;
+    _HPyFunc_args_NEWFUNC *a = (_HPyFunc_args_NEWFUNC*)args;
+    Py_ssize_t nargs = PyTuple_GET_SIZE(a->args);
+    HPy small_args[SMALL_NARGS];
+    HPy *h_args = ARGS_BUFFER(small_args, nargs);
+    _py2h_args(h_args, &PyTuple_GET_ITEM(a->args, 0), nargs);
+    a->result = _h2py(f(ctx, _py2h(a->self), h_args, nargs, _py2h(a->kw)));
+}
+
+static void
+call_GETBUFFERPROC(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_getbufferproc f = (HPyFunc_getbufferproc)func;
+    _HPyFunc_args_GETBUFFERPROC *a = (_HPyFunc_args_GETBUFFERPROC*)args;
+    HPy_buffer hbuf;
+    a->result = f(ctx, _py2h(a->self), &hbuf, a->flags);
+    if (a->result < 0) {
+        a->view->obj = NULL;
         return;
     }
-    case HPyFunc_MOD_CREATE: {
-            HPyFunc_unaryfunc f = (HPyFunc_unaryfunc)func;
-            _HPyFunc_args_UNARYFUNC *a = (_HPyFunc_args_UNARYFUNC*)args;
-            a->result = _h2py(f(ctx, _py2h(a->arg0)));
-            _HPyModule_CheckCreateSlotResult(&a->result);
-            return;
-    }
+    _buffer_h2py(ctx, &hbuf, a->view);
+    HPy_Close(ctx, hbuf.obj);
+}
+
+static void
+call_RELEASEBUFFERPROC(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_releasebufferproc f = (HPyFunc_releasebufferproc)func;
+    _HPyFunc_args_RELEASEBUFFERPROC *a = (_HPyFunc_args_RELEASEBUFFERPROC*)args;
+    HPy_buffer hbuf;
+    _buffer_py2h(ctx, a->view, &hbuf);
+    f(ctx, _py2h(a->self), &hbuf);
+    // XXX: copy back from hbuf?
+    HPy_Close(ctx, hbuf.obj);
+}
+
+static void
+call_TRAVERSEPROC(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_traverseproc f = (HPyFunc_traverseproc)func;
+    _HPyFunc_args_TRAVERSEPROC *a = (_HPyFunc_args_TRAVERSEPROC*)args;
+    a->result = call_traverseproc_from_trampoline(f, a->self,
+                                                  a->visit, a->arg);
+}
+
+static void
+call_CAPSULE_DESTRUCTOR(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_Capsule_Destructor f = (HPyFunc_Capsule_Destructor)func;
+    PyObject *capsule = (PyObject *)args;
+    const char *name = PyCapsule_GetName(capsule);
+    f(name, PyCapsule_GetPointer(capsule, name),
+            PyCapsule_GetContext(capsule));
+}
+
+static void
+call_MOD_CREATE(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_unaryfunc f = (HPyFunc_unaryfunc)func;
+    _HPyFunc_args_UNARYFUNC *a = (_HPyFunc_args_UNARYFUNC*)args;
+    a->result = _h2py(f(ctx, _py2h(a->arg0)));
+    _HPyModule_CheckCreateSlotResult(&a->result);
+}
+
+static void
+call_ITERNEXTBATCHFUNC(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_iternextbatchfunc f = (HPyFunc_iternextbatchfunc)func;
+    _HPyFunc_args_ITERNEXTBATCHFUNC *a = (_HPyFunc_args_ITERNEXTBATCHFUNC*)args;
+    /* HPy and PyObject* have the same size: the items are converted in place */
+    HPy *h_items = (HPy *)a->items;
+    a->result = f(ctx, _py2h(a->self), h_items, a->n);
+    for (HPy_ssize_t i = 0; i < a->result; i++)
+        a->items[i] = _h2py(h_items[i]);
+}
+
+static void
+call_SENDFUNC(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    HPyFunc_sendfunc f = (HPyFunc_sendfunc)func;
+    _HPyFunc_args_SENDFUNC *a = (_HPyFunc_args_SENDFUNC*)args;
+    HPy h_result = HPy_NULL;
+    a->result = f(ctx, _py2h(a->self), _py2h(a->value), &h_result);
+    *a->presult = _h2py(h_result);
+}
+
 #include "autogen_ctx_call.i"
+
+#define CALL_SIGNATURES(X)      \
+    X(VARARGS)                  \
+    X(KEYWORDS)                 \
+    X(KWTABLE)                  \
+    X(INITPROC)                 \
+    X(NEWFUNC)                  \
+    X(GETBUFFERPROC)            \
+    X(RELEASEBUFFERPROC)        \
+    X(ITERNEXTBATCHFUNC)        \
+    X(SENDFUNC)                 \
+    X(TRAVERSEPROC)             \
+    X(CAPSULE_DESTRUCTOR)       \
+    X(MOD_CREATE)               \
+    _HPY_AUTOGEN_CALL_SIGNATURES(X)
+
+HPyAPI_IMPL void
+ctx_CallRealFunctionFromTrampoline(HPyContext *ctx, HPyFunc_Signature sig,
+                                   HPyCFunction func, void *args)
+{
+    switch (sig) {
+#define CASE(NAME)                          \
+    case HPyFunc_##NAME:                    \
+        call_##NAME(ctx, func, args);       \
+        return;
+    CALL_SIGNATURES(CASE)
+#undef CASE
     default:
         Py_FatalError("Unsupported HPyFunc_Signature in ctx_meth.c");
     }
 }
+
+static void
+call_unsupported(HPyContext *ctx, HPyCFunction func, void *args)
+{
+    Py_FatalError("Unsupported HPyFunc_Signature in ctx_meth.c");
+}
+
+/* HPyFunc_SENDFUNC is the last member of HPyFunc_Signature. If new
+   signatures are added, the trampolines of the modules fall back to
+   ctx_CallRealFunctionFromTrampoline for those which are beyond the table. */
+#define N_DIRECT_CALLS (HPyFunc_SENDFUNC + 1)
+
+const _HPyFunc_DirectCallTable *
+get_direct_call_table(void)
+{
+    static _HPyFunc_DirectCall calls[N_DIRECT_CALLS];
+    static _HPyFunc_DirectCallTable table = { 0, NULL };
+    if (table.calls == NULL) {
+        for (size_t i = 0; i < N_DIRECT_CALLS; i++)
+            calls[i] = call_unsupported;
+#define ENTRY(NAME) calls[HPyFunc_##NAME] = call_##NAME;
+        CALL_SIGNATURES(ENTRY)
+#undef ENTRY
+        table.size = N_DIRECT_CALLS;
+        table.calls = calls;
+    }
+    return &table;
+}
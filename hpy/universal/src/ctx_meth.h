@@ -4,3 +4,8 @@
 HPyAPI_IMPL void
 ctx_CallRealFunctionFromTrampoline(HPyContext *ctx, HPyFunc_Signature sig,
                                    HPyCFunction func, void *args);
+
+/* Returns the table of per-signature entry points which is passed to
+   universal modules when loading them, see HPyInitDirectCalls_<ext>. */
+const _HPyFunc_DirectCallTable *
+get_direct_call_table(void);
@@ -33,6 +33,33 @@ ctx_Dup(HPyContext *ctx, HPy h)
     return _py2h(obj);
 }
 
+HPyAPI_IMPL void
+ctx_CloseMany(HPyContext *ctx, const HPy *hs, HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        Py_XDECREF(_h2py(hs[i]));
+    }
+}
+
+HPyAPI_IMPL void
+ctx_DupMany(HPyContext *ctx, const HPy *hs, HPy *out, HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        PyObject *obj = _h2py(hs[i]);
+        Py_XINCREF(obj);
+        out[i] = _py2h(obj);
+    }
+}
+
+/* CPython does not need a write barrier, but ctx_Field_WriteBarrier can be
+   set on the universal context e.g. to experiment with other GCs */
+static inline void
+field_write_barrier(HPyContext *ctx, HPy target_object)
+{
+    if (ctx->ctx_Field_WriteBarrier != NULL)
+        ctx->ctx_Field_WriteBarrier(ctx, target_object);
+}
+
 HPyAPI_IMPL void
 ctx_Field_Store(HPyContext *ctx, HPy target_object, HPyField *target_field, HPy h)
 {
@@ -41,6 +68,7 @@ ctx_Field_Store(HPyContext *ctx, HPy target_object, HPyField *target_field, HPy
     Py_XINCREF(obj);
     *target_field = _py2hf(obj);
     Py_XDECREF(target_py_obj);
+    field_write_barrier(ctx, target_object);
 }
 
 HPyAPI_IMPL HPy
@@ -51,6 +79,31 @@ ctx_Field_Load(HPyContext *ctx, HPy source_object, HPyField source_field)
     return _py2h(obj);
 }
 
+HPyAPI_IMPL void
+ctx_Field_StoreMany(HPyContext *ctx, HPy target_object,
+                    HPyField **target_fields, const HPy *hs, HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        PyObject *obj = _h2py(hs[i]);
+        PyObject *target_py_obj = _hf2py(*target_fields[i]);
+        Py_XINCREF(obj);
+        *target_fields[i] = _py2hf(obj);
+        Py_XDECREF(target_py_obj);
+    }
+    field_write_barrier(ctx, target_object);
+}
+
+HPyAPI_IMPL void
+ctx_Field_LoadMany(HPyContext *ctx, HPy source_object,
+                   HPyField **source_fields, HPy *out, HPy_ssize_t n)
+{
+    for (HPy_ssize_t i = 0; i < n; i++) {
+        PyObject *obj = _hf2py(*source_fields[i]);
+        Py_INCREF(obj);
+        out[i] = _py2h(obj);
+    }
+}
+
 
 HPyAPI_IMPL void
 ctx_Global_Store(HPyContext *ctx, HPyGlobal *global, HPy h)
@@ -81,3 +134,153 @@ ctx_Type_IsSubtype(HPyContext *ctx, HPy sub, HPy type)
     return PyType_IsSubtype((PyTypeObject *)_h2py(sub),
             (PyTypeObject *)_h2py(type));
 }
+
+/* The types created by HPyStructSequence_NewType in the universal ABI are
+   namedtuples which store their field count in the 'n_fields' class
+   attribute and are marked by the private '_hpy_structseq' class attribute.
+   Only those are filled directly: other types with an 'n_fields' attribute
+   (e.g. native struct sequences like 'time.struct_time', which count their
+   hidden fields too) are called instead. Since the marked types are created
+   by Python code, there is no room for C data in the type itself: instead,
+   the field counts are cached here, keyed
+   by type and version tag. CPython assigns a new version tag whenever a type
+   is modified (and the first time an attribute is looked up on it, e.g. when
+   accessing a field of an instance), so an entry with a matching tag is
+   always up to date. */
+#define N_FIELDS_CACHE_SIZE 16
+
+static struct {
+    PyTypeObject *type;
+    unsigned int version_tag;
+    Py_ssize_t n_fields;
+} n_fields_cache[N_FIELDS_CACHE_SIZE];
+
+static inline int has_valid_version_tag(PyTypeObject *tp)
+{
+    return tp->tp_version_tag != 0 &&
+           PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG);
+}
+
+/* If 'tp' itself (not a base) is marked as created by
+   HPyStructSequence_NewType, read the field count stored in its dict into
+   '*n_fields'. Return 1 on success, 0 if 'tp' is not marked (e.g. it is a
+   subclass of such a type, or a native struct sequence type), or -1 with an
+   exception set. */
+static int get_own_n_fields(PyTypeObject *tp, PyObject *s_marker,
+                            PyObject *s_n_fields, Py_ssize_t *n_fields)
+{
+    unsigned int version_tag = tp->tp_version_tag;
+    size_t index = version_tag % N_FIELDS_CACHE_SIZE;
+    PyObject *v;
+
+    if (has_valid_version_tag(tp) &&
+            n_fields_cache[index].type == tp &&
+            n_fields_cache[index].version_tag == version_tag) {
+        *n_fields = n_fields_cache[index].n_fields;
+        return 1;
+    }
+
+#if PY_VERSION_HEX >= 0x030C0000
+    PyObject *dict = PyType_GetDict(tp);
+#else
+    PyObject *dict = tp->tp_dict;
+#endif
+    v = PyDict_GetItemWithError(dict, s_marker);
+    if (v != NULL)
+        v = PyDict_GetItemWithError(dict, s_n_fields);
+    Py_XINCREF(v);
+#if PY_VERSION_HEX >= 0x030C0000
+    Py_DECREF(dict);
+#endif
+    if (v == NULL)
+        return PyErr_Occurred() ? -1 : 0;
+    *n_fields = PyLong_AsSsize_t(v);
+    Py_DECREF(v);
+    if (*n_fields == -1 && PyErr_Occurred())
+        return -1;
+    if (has_valid_version_tag(tp)) {
+        n_fields_cache[index].type = tp;
+        n_fields_cache[index].version_tag = version_tag;
+        n_fields_cache[index].n_fields = *n_fields;
+    }
+    return 1;
+}
+
+HPyAPI_IMPL HPy
+ctx_StructSequence_New(HPyContext *ctx, HPy type, HPy_ssize_t nargs,
+                       const HPy *args)
+{
+    static PyObject *s_marker = NULL;
+    static PyObject *s_n_fields = NULL;
+    PyObject *obj = _h2py(type);
+    PyTypeObject *tp;
+    PyObject *v, *result;
+    Py_ssize_t n_fields, i;
+    int found;
+
+    if (!PyType_Check(obj) ||
+            !PyType_IsSubtype((PyTypeObject *)obj, &PyTuple_Type))
+        goto type_error;
+    tp = (PyTypeObject *)obj;
+    if (s_n_fields == NULL) {
+        s_marker = PyUnicode_InternFromString("_hpy_structseq");
+        if (s_marker == NULL)
+            return HPy_NULL;
+        s_n_fields = PyUnicode_InternFromString("n_fields");
+        if (s_n_fields == NULL)
+            return HPy_NULL;
+    }
+    found = get_own_n_fields(tp, s_marker, s_n_fields, &n_fields);
+    if (found < 0)
+        goto type_error;
+    if (!found) {
+        /* e.g. a subclass of a struct sequence type, which may override
+           __new__, or a native struct sequence type: do a full lookup and
+           call the type */
+        v = PyObject_GetAttr(obj, s_n_fields);
+        if (v == NULL)
+            goto type_error;
+        n_fields = PyLong_AsSsize_t(v);
+        Py_DECREF(v);
+        if (n_fields == -1 && PyErr_Occurred())
+            goto type_error;
+        if (n_fields != nargs)
+            goto count_error;
+        PyObject *tuple = PyTuple_New(nargs);
+        if (tuple == NULL)
+            return HPy_NULL;
+        for (i = 0; i < nargs; i++) {
+            PyObject *item = _h2py(args[i]);
+            Py_INCREF(item);
+            PyTuple_SET_ITEM(tuple, i, item);
+        }
+        result = PyObject_Call(obj, tuple, NULL);
+        Py_DECREF(tuple);
+        return _py2h(result);
+    }
+    if (n_fields != nargs)
+        goto count_error;
+    /* the type is exactly a type created by HPyStructSequence_NewType,
+       whose __new__ only builds the tuple: fill it directly */
+    result = tp->tp_alloc(tp, nargs);
+    if (result == NULL)
+        return HPy_NULL;
+    for (i = 0; i < nargs; i++) {
+        PyObject *item = _h2py(args[i]);
+        Py_INCREF(item);
+        PyTuple_SET_ITEM(result, i, item);
+    }
+    return _py2h(result);
+
+count_error:
+    PyErr_Format(PyExc_TypeError,
+                 "expected exactly %zd arguments but got %zd",
+                 n_fields, nargs);
+    return HPy_NULL;
+
+type_error:
+    PyErr_Clear();
+    PyErr_Format(PyExc_TypeError,
+                 "object '%R' does not look like a struct sequence type", obj);
+    return HPy_NULL;
+}
@@ -8,13 +8,24 @@ HPyAPI_IMPL HPy ctx_FromPyObject(HPyContext *ctx, cpy_PyObject *obj);
 HPyAPI_IMPL cpy_PyObject *ctx_AsPyObject(HPyContext *ctx, HPy h);
 HPyAPI_IMPL void ctx_Close(HPyContext *ctx, HPy h);
 HPyAPI_IMPL HPy ctx_Dup(HPyContext *ctx, HPy h);
+HPyAPI_IMPL void ctx_CloseMany(HPyContext *ctx, const HPy *hs, HPy_ssize_t n);
+HPyAPI_IMPL void ctx_DupMany(HPyContext *ctx, const HPy *hs, HPy *out,
+                             HPy_ssize_t n);
 HPyAPI_IMPL void ctx_Field_Store(HPyContext *ctx, HPy target_object,
                                  HPyField *target_field, HPy h);
 HPyAPI_IMPL HPy ctx_Field_Load(HPyContext *ctx, HPy source_object,
                                HPyField source_field);
+HPyAPI_IMPL void ctx_Field_StoreMany(HPyContext *ctx, HPy target_object,
+                                     HPyField **target_fields, const HPy *hs,
+                                     HPy_ssize_t n);
+HPyAPI_IMPL void ctx_Field_LoadMany(HPyContext *ctx, HPy source_object,
+                                    HPyField **source_fields, HPy *out,
+                                    HPy_ssize_t n);
 HPyAPI_IMPL void ctx_Global_Store(HPyContext *ctx, HPyGlobal *global, HPy h);
 HPyAPI_IMPL HPy ctx_Global_Load(HPyContext *ctx, HPyGlobal global);
 HPyAPI_IMPL void ctx_FatalError(HPyContext *ctx, const char *message);
 HPyAPI_IMPL int ctx_Type_IsSubtype(HPyContext *ctx, HPy sub, HPy type);
+HPyAPI_IMPL HPy ctx_StructSequence_New(HPyContext *ctx, HPy type,
+                                       HPy_ssize_t nargs, const HPy *args);
 
 #endif /* HPY_CTX_MISC_H */
@@ -15,6 +15,14 @@ static inline HPy _py2h(PyObject *obj) {
     return (HPy){(HPy_ssize_t)obj + 1};
 }
 
+// Like _py2h, but only for objects which are known to be non-NULL, e.g. the
+// arguments of a call. Since the handle is just the address plus a constant
+// offset, the conversion is a single addition and needs no branch.
+static inline HPy _py2h_nonnull(PyObject *obj) {
+    assert(obj != NULL);
+    return (HPy){(HPy_ssize_t)obj + 1};
+}
+
 static inline PyObject *_h2py(HPy h) {
     if HPy_IsNull(h)
         return NULL;
@@ -14,6 +14,7 @@
 
 #include "api.h"
 #include "handles.h"
+#include "ctx_meth.h"
 #include "hpy/version.h"
 #include "hpy_debug.h"
 #include "hpy_trace.h"
@@ -46,9 +47,11 @@ typedef enum {
 typedef uint32_t (*VersionGetterFuncPtr)(void);
 typedef HPyModuleDef* (*InitFuncPtr)(void);
 typedef void (*InitContextFuncPtr)(HPyContext*);
+typedef void (*InitDirectCallsFuncPtr)(const _HPyFunc_DirectCallTable*);
 
 static const char *init_prefix = "HPyInit";
 static const char *init_ctx_prefix = "HPyInitGlobalContext_";
+static const char *init_direct_calls_prefix = "HPyInitDirectCalls";
 
 static inline int
 _hpy_strncmp_ignore_case(const char *s0, const char *s1, size_t n)
@@ -60,7 +63,7 @@ _hpy_strncmp_ignore_case(const char *s0, const char *s1, size_t n)
 #endif
 }
 
-static HPyContext * get_context(HPyMode mode)
+static HPyContext * get_context(HPyMode mode, const char *modname)
 {
     switch (mode)
     {
@@ -69,7 +72,9 @@ static HPyContext * get_context(HPyMode mode)
     case MODE_DEBUG:
         return hpy_debug_get_ctx(&g_universal_ctx);
     case MODE_TRACE:
-        return hpy_trace_get_ctx(&g_universal_ctx);
+        // every module gets its own trace context, such that the trace mode
+        // can attribute the API calls to the calling module
+        return hpy_trace_get_module_ctx(&g_universal_ctx, modname);
     // case MODE_DEBUG_TRACE:
     //     return hpy_debug_get_ctx(hpy_trace_get_ctx(&g_universal_ctx));
     // case MODE_TRACE_DEBUG:
@@ -227,7 +232,10 @@ static PyObject *do_load(PyObject *name_unicode, PyObject *path, HPyMode mode, P
         goto error;
     }
 
-    HPyContext *ctx = get_context(mode);
+    const char *modname = PyUnicode_AsUTF8(name_unicode);
+    if (modname == NULL)
+        goto error;
+    HPyContext *ctx = get_context(mode, modname);
     if (ctx == NULL)
         goto error;
 
@@ -241,6 +249,19 @@ static PyObject *do_load(PyObject *name_unicode, PyObject *path, HPyMode mode, P
     }
     ((InitContextFuncPtr)initctxfn)(ctx);
 
+    /* Modules built with older versions of HPy don't have this function and
+       always use the generic ctx_CallRealFunctionFromTrampoline. The debug and
+       trace contexts need to wrap every call, so they also use the generic
+       entry point. */
+    char init_direct_calls_name[258];
+    PyOS_snprintf(init_direct_calls_name, sizeof(init_direct_calls_name),
+                  "%.20s_%.200s", init_direct_calls_prefix, shortname);
+    void *initdirectcallsfn = dlsym(mylib, init_direct_calls_name);
+    if (initdirectcallsfn != NULL) {
+        ((InitDirectCallsFuncPtr)initdirectcallsfn)(
+                mode == MODE_UNIVERSAL ? get_direct_call_table() : NULL);
+    }
+
     char init_name[258];
     PyOS_snprintf(init_name, sizeof(init_name), "%.20s_%.200s",
                   init_prefix, shortname);
@@ -559,12 +580,14 @@ int exec_module(PyObject* mod) {
         return -1;
 
     HPyInitGlobalContext__debug(ctx);
+    HPyInitDirectCalls__debug(get_direct_call_table());
     int result = initialize_module(ctx, mod, "_debug", "hpy.debug._debug",
                       HPyInit__debug(), spec_from_file_and_location, location);
     if (result != 0)
         return result;
 
     HPyInitGlobalContext__trace(ctx);
+    HPyInitDirectCalls__trace(get_direct_call_table());
     result = initialize_module(ctx, mod, "_trace", "hpy.trace._trace",
                       HPyInit__trace(), spec_from_file_and_location, location);
     if (result != 0)
@@ -69,8 +69,32 @@ class TimerSession:
             return f'[{ratio:.2f}]'
         return ''
 
+    MODES = ('hpy-debug', 'hpy-trace')
+
+    def display_modes(self, tr):
+        """ Overhead of the debug and trace modes compared to the universal
+            mode, for each benchmark run in at least one of them. """
+        w = tr.write_line
+        w('')
+        tr.write_sep('=', 'HPY MODES', cyan=True)
+        w(' '*40 + '             hpy          hpy-debug          hpy-trace')
+        w(' '*40 + '----------------   ----------------   ----------------')
+        for shortid, timings in self.table.items():
+            if not any(timings.get(mode) for mode in self.MODES):
+                continue
+            hpy = timings.get('hpy')
+            cols = [f'{hpy or ""!s:>15}']
+            for mode in self.MODES:
+                t = timings.get(mode)
+                ratio = self.format_ratio(hpy, t)
+                cols.append(f'{t or ""!s:>10} {ratio:>7}')
+            w(f'{shortid:<40} ' + ' '.join(cols))
+
     def display_summary(self, tr):
         w = tr.write_line
+        # the BENCHMARKS table must come last, see print_other_vs_cpy.py
+        if any(mode in self.apis for mode in self.MODES):
+            self.display_modes(tr)
         w('')
         tr.write_sep('=', 'BENCHMARKS', cyan=True)
         w(' '*40 + '             cpy                    hpy')
@@ -95,6 +119,8 @@ def pytest_configure(config):
     config._timersession = TimerSession()
     config.addinivalue_line("markers", "hpy: mark modules using the HPy API")
     config.addinivalue_line("markers", "cpy: mark modules using the old Python/C API")
+    config.addinivalue_line("markers", "hpy_debug: mark HPy modules loaded in debug mode")
+    config.addinivalue_line("markers", "hpy_trace: mark HPy modules loaded in trace mode")
 
 def pytest_addoption(parser):
     parser.addoption(
@@ -1,17 +1,21 @@
-import sys
+"""
+Compare the results of `make bench` of another Python implementation to the
+ones of CPython:
 
-from pathlib import Path
+    python print_other_vs_cpy.py PyPy [--json report.json]
+                                      [--baseline old.json [--threshold 1.1]]
 
-try:
-    other = sys.argv[1]
-except IndexError:
-    other = "PyPy"
+With --json, the timings and the ratios are also written to a JSON file.
+With --baseline, the ratios are compared to the ones of a previous JSON
+report: the benchmarks whose ratio grew by more than the threshold are
+reported as regressions, and the exit status is 1 if there is any.
+"""
 
-path_result_cpy = Path("tmp_results_cpython.txt")
-path_result_other = Path(f"tmp_results_{other.lower()}.txt")
+import argparse
+import json
+import sys
 
-assert path_result_cpy.exists()
-assert path_result_other.exists()
+from pathlib import Path
 
 
 def data_from_path(path):
@@ -41,19 +45,85 @@ def data_from_path(path):
     return names, times
 
 
-names, times_cpy = data_from_path(path_result_cpy)
-names, times_other = data_from_path(path_result_other)
-
-max_length_name = 45
-fmt_name = f"{{:{max_length_name}s}}"
-
-out = f" {other} HPy univ / CPy native (time ratio, smaller is better) "
-num_chars = 81
-num_equals = (num_chars - len(out)) // 2
-
-print("\n" + num_equals * "=" + out + num_equals * "=")
-
-for index, t_other in enumerate(times_other):
-    ratio = t_other / times_cpy[index]
-    name = fmt_name.format(names[index])
-    print(f"{name} {ratio:.2f}")
+def make_report(other, names, times_cpy, times_other):
+    benchmarks = []
+    for index, t_other in enumerate(times_other):
+        benchmarks.append({
+            "name": names[index],
+            "cpy": times_cpy[index],
+            "other": t_other,
+            "ratio": t_other / times_cpy[index],
+        })
+    return {"other": other, "benchmarks": benchmarks}
+
+
+def find_regressions(report, baseline, threshold):
+    base_ratios = {b["name"]: b["ratio"] for b in baseline["benchmarks"]}
+    regressions = []
+    for b in report["benchmarks"]:
+        base = base_ratios.get(b["name"])
+        if base is not None and b["ratio"] > base * threshold:
+            regressions.append({"name": b["name"], "baseline": base,
+                                "ratio": b["ratio"]})
+    return regressions
+
+
+def main(argv=None):
+    parser = argparse.ArgumentParser(
+        description="Compare the microbenchmarks of HPy universal on another "
+                    "Python implementation to CPython native.")
+    parser.add_argument("other", nargs="?", default="PyPy",
+                        help="name of the other implementation (default: PyPy)")
+    parser.add_argument("--json", metavar="OUT",
+                        help="write a machine-readable report to OUT")
+    parser.add_argument("--baseline", metavar="JSON",
+                        help="report written by a previous run with --json")
+    parser.add_argument("--threshold", type=float, default=1.1,
+                        help="relative growth of a ratio compared to the "
+                             "baseline which is a regression (default: 1.1)")
+    args = parser.parse_args(argv)
+    other = args.other
+
+    path_result_cpy = Path("tmp_results_cpython.txt")
+    path_result_other = Path(f"tmp_results_{other.lower()}.txt")
+
+    assert path_result_cpy.exists()
+    assert path_result_other.exists()
+
+    names, times_cpy = data_from_path(path_result_cpy)
+    names, times_other = data_from_path(path_result_other)
+    report = make_report(other, names, times_cpy, times_other)
+
+    max_length_name = 45
+    fmt_name = f"{{:{max_length_name}s}}"
+
+    out = f" {other} HPy univ / CPy native (time ratio, smaller is better) "
+    num_chars = 81
+    num_equals = (num_chars - len(out)) // 2
+
+    print("\n" + num_equals * "=" + out + num_equals * "=")
+
+    for b in report["benchmarks"]:
+        name = fmt_name.format(b["name"])
+        print(f"{name} {b['ratio']:.2f}")
+
+    regressions = []
+    if args.baseline:
+        baseline = json.loads(Path(args.baseline).read_text())
+        regressions = find_regressions(report, baseline, args.threshold)
+        report["baseline"] = args.baseline
+        report["threshold"] = args.threshold
+        report["regressions"] = regressions
+        print(f"\nRegressions compared to {args.baseline}: {len(regressions)}")
+        for r in regressions:
+            name = fmt_name.format(r["name"])
+            print(f"{name} {r['baseline']:.2f} -> {r['ratio']:.2f}")
+
+    if args.json:
+        Path(args.json).write_text(json.dumps(report, indent=2) + "\n")
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -57,6 +57,90 @@ static PyObject* allocate_tuple(PyObject* self, PyObject* args)
     return Py_BuildValue("ii", 2048, 2049);
 }
 
+static PyObject* parse_args(PyObject* self, PyObject* args)
+{
+    long a, b;
+    double c;
+    if (!PyArg_ParseTuple(args, "lld", &a, &b, &c))
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* parse_args_kw(PyObject* self, PyObject* args, PyObject* kw)
+{
+    static char *kwlist[] = { "a", "b", "c", NULL };
+    long a, b;
+    double c = 0.0;
+    if (!PyArg_ParseTupleAndKeywords(args, kw, "ll|d", kwlist, &a, &b, &c))
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* build_value_nested(PyObject* self, PyObject* args)
+{
+    return Py_BuildValue("(ii)[id]{s:i,s:(ii)}", 1, 2, 3, 4.0,
+                         "x", 5, "y", 6, 7);
+}
+
+#define N_BUILDER_ITEMS 8
+
+static PyObject* tuple_builder(PyObject* self, PyObject* arg)
+{
+    PyObject *res = PyTuple_New(N_BUILDER_ITEMS);
+    if (res == NULL)
+        return NULL;
+    for (Py_ssize_t i = 0; i < N_BUILDER_ITEMS; i++) {
+        Py_INCREF(arg);
+        PyTuple_SET_ITEM(res, i, arg);
+    }
+    return res;
+}
+
+static PyObject* list_builder(PyObject* self, PyObject* arg)
+{
+    PyObject *res = PyList_New(N_BUILDER_ITEMS);
+    if (res == NULL)
+        return NULL;
+    for (Py_ssize_t i = 0; i < N_BUILDER_ITEMS; i++) {
+        Py_INCREF(arg);
+        PyList_SET_ITEM(res, i, arg);
+    }
+    return res;
+}
+
+static PyObject* unicode_as_utf8(PyObject* self, PyObject* arg)
+{
+    Py_ssize_t size;
+    if (PyUnicode_AsUTF8AndSize(arg, &size) == NULL)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject* getattr_s(PyObject* self, PyObject* arg)
+{
+    return PyObject_GetAttrString(arg, "real");
+}
+
+/* the heap types, set by PyInit_cpy_simple */
+static PyTypeObject *g_HTFoo;
+static PyTypeObject *g_Container;
+
+static PyObject* global_load(PyObject* self, PyObject* args)
+{
+    Py_INCREF(g_HTFoo);
+    return (PyObject *)g_HTFoo;
+}
+
+static PyObject* new_obj(PyObject* self, PyObject* args)
+{
+    return g_HTFoo->tp_alloc(g_HTFoo, 0);
+}
+
+static PyObject* new_gc_obj(PyObject* self, PyObject* args)
+{
+    return g_Container->tp_alloc(g_Container, 0);
+}
+
 static PyObject * Foo_getitem(PyObject *self, Py_ssize_t i)
 {
     Py_RETURN_NONE;
@@ -67,6 +151,21 @@ static Py_ssize_t Foo_len(PyObject *self)
     return 42;
 }
 
+static PyObject * Foo_richcompare(PyObject *self, PyObject *other, int op)
+{
+    if (op == Py_LT)
+        Py_RETURN_TRUE;
+    Py_RETURN_NOTIMPLEMENTED;
+}
+
+static char foo_buffer_data[16];
+
+static int Foo_getbuffer(PyObject *self, Py_buffer *view, int flags)
+{
+    return PyBuffer_FillInfo(view, self, foo_buffer_data,
+                             sizeof(foo_buffer_data), 1, flags);
+}
+
 static PyMethodDef SimpleMethods[] = {
     {"noargs", (PyCFunction)noargs, METH_NOARGS, ""},
     {"onearg", (PyCFunction)onearg, METH_O, ""},
@@ -75,6 +174,16 @@ static PyMethodDef SimpleMethods[] = {
     {"call_with_tuple_and_dict", (PyCFunction)call_with_tuple_and_dict, METH_VARARGS, ""},
     {"allocate_int", (PyCFunction)allocate_int, METH_NOARGS, ""},
     {"allocate_tuple", (PyCFunction)allocate_tuple, METH_NOARGS, ""},
+    {"parse_args", (PyCFunction)parse_args, METH_VARARGS, ""},
+    {"parse_args_kw", (PyCFunction)(void(*)(void))parse_args_kw, METH_VARARGS | METH_KEYWORDS, ""},
+    {"build_value_nested", (PyCFunction)build_value_nested, METH_NOARGS, ""},
+    {"tuple_builder", (PyCFunction)tuple_builder, METH_O, ""},
+    {"list_builder", (PyCFunction)list_builder, METH_O, ""},
+    {"unicode_as_utf8", (PyCFunction)unicode_as_utf8, METH_O, ""},
+    {"getattr_s", (PyCFunction)getattr_s, METH_O, ""},
+    {"global_load", (PyCFunction)global_load, METH_NOARGS, ""},
+    {"new_obj", (PyCFunction)new_obj, METH_NOARGS, ""},
+    {"new_gc_obj", (PyCFunction)new_gc_obj, METH_NOARGS, ""},
     {NULL, NULL, 0, NULL}
 };
 
@@ -85,6 +194,10 @@ static PySequenceMethods FooSequence = {
 	NULL,
 };
 
+static PyBufferProcs FooBuffer = {
+	.bf_getbuffer = (getbufferproc)Foo_getbuffer,
+};
+
 
 /* types */
 
@@ -111,12 +224,12 @@ static PyTypeObject Foo_Type = {
     0,                         /* tp_str */
     0,                         /* tp_getattro */
     0,                         /* tp_setattro */
-    0,                         /* tp_as_buffer */
+    &FooBuffer,                /* tp_as_buffer */
     Py_TPFLAGS_DEFAULT,        /* tp_flags */
     "Foo objects",             /* tp_doc */
     0,                         /* tp_traverse */
     0,                         /* tp_clear */
-    0,                         /* tp_richcompare */
+    (richcmpfunc)Foo_richcompare, /* tp_richcompare */
     0,                         /* tp_weaklistoffset */
     0,                         /* tp_iter */
     0,                         /* tp_iternext */
@@ -129,6 +242,8 @@ static PyType_Slot HTFoo_slots[] = {
     {Py_tp_methods, SimpleMethods},
     {Py_sq_item, Foo_getitem},
     {Py_sq_length, Foo_len},
+    {Py_tp_richcompare, Foo_richcompare},
+    {Py_bf_getbuffer, Foo_getbuffer},
     {0, 0}
 };
 
@@ -140,6 +255,73 @@ static PyType_Spec HTFoo_Type_spec = {
     .slots = HTFoo_slots
 };
 
+/* Container type: a GC type holding one object */
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *item;
+} ContainerObject;
+
+static int Container_traverse(ContainerObject *self, visitproc visit, void *arg)
+{
+    Py_VISIT(self->item);
+    Py_VISIT(Py_TYPE(self));
+    return 0;
+}
+
+static int Container_clear(ContainerObject *self)
+{
+    Py_CLEAR(self->item);
+    return 0;
+}
+
+static void Container_dealloc(ContainerObject *self)
+{
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_GC_UnTrack(self);
+    Container_clear(self);
+    tp->tp_free((PyObject *)self);
+    Py_DECREF(tp);
+}
+
+static PyObject* Container_store(ContainerObject *self, PyObject *arg)
+{
+    PyObject *old = self->item;
+    Py_INCREF(arg);
+    self->item = arg;
+    Py_XDECREF(old);
+    Py_RETURN_NONE;
+}
+
+static PyObject* Container_load(ContainerObject *self, PyObject *args)
+{
+    PyObject *res = self->item ? self->item : Py_None;
+    Py_INCREF(res);
+    return res;
+}
+
+static PyMethodDef ContainerMethods[] = {
+    {"store", (PyCFunction)Container_store, METH_O, ""},
+    {"load", (PyCFunction)Container_load, METH_NOARGS, ""},
+    {NULL, NULL, 0, NULL}
+};
+
+static PyType_Slot Container_slots[] = {
+    {Py_tp_methods, ContainerMethods},
+    {Py_tp_traverse, Container_traverse},
+    {Py_tp_clear, Container_clear},
+    {Py_tp_dealloc, Container_dealloc},
+    {0, 0}
+};
+
+static PyType_Spec Container_Type_spec = {
+    .name = "cpy_simple.Container",
+    .basicsize = sizeof(ContainerObject),
+    .itemsize = 0,
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,
+    .slots = Container_slots
+};
+
 static struct PyModuleDef moduledef = {
     PyModuleDef_HEAD_INIT,
     "cpy_simple",
@@ -168,7 +350,16 @@ PyInit_cpy_simple(void)
     PyObject *HTFoo_Type = PyType_FromSpec(&HTFoo_Type_spec);
     if (HTFoo_Type == NULL)
         return NULL;
+    Py_INCREF(HTFoo_Type);
+    g_HTFoo = (PyTypeObject *)HTFoo_Type;
     PyModule_AddObject(m, "HTFoo", HTFoo_Type);
 
+    PyObject *Container_Type = PyType_FromSpec(&Container_Type_spec);
+    if (Container_Type == NULL)
+        return NULL;
+    Py_INCREF(Container_Type);
+    g_Container = (PyTypeObject *)Container_Type;
+    PyModule_AddObject(m, "Container", Container_Type);
+
     return m;
 }
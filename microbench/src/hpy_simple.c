@@ -59,6 +59,102 @@ static HPy allocate_tuple_impl(HPyContext *ctx, HPy self)
     return HPy_BuildValue(ctx, "ii", 2048, 2049);
 }
 
+HPyDef_METH(parse_args, "parse_args", HPyFunc_VARARGS)
+static HPy parse_args_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+{
+    long a, b;
+    double c;
+    if (!HPyArg_Parse(ctx, NULL, args, nargs, "lld", &a, &b, &c))
+        return HPy_NULL;
+    return HPy_Dup(ctx, ctx->h_None);
+}
+
+HPyDef_METH(parse_args_kw, "parse_args_kw", HPyFunc_KEYWORDS)
+static HPy parse_args_kw_impl(HPyContext *ctx, HPy self, const HPy *args,
+                              size_t nargs, HPy kwnames)
+{
+    static const char *kwlist[] = { "a", "b", "c", NULL };
+    long a, b;
+    double c = 0.0;
+    if (!HPyArg_ParseKeywords(ctx, NULL, args, nargs, kwnames, "ll|d", kwlist,
+                              &a, &b, &c))
+        return HPy_NULL;
+    return HPy_Dup(ctx, ctx->h_None);
+}
+
+HPyDef_METH(build_value_nested, "build_value_nested", HPyFunc_NOARGS)
+static HPy build_value_nested_impl(HPyContext *ctx, HPy self)
+{
+    return HPy_BuildValue(ctx, "(ii)[id]{s:i,s:(ii)}", 1, 2, 3, 4.0,
+                          "x", 5, "y", 6, 7);
+}
+
+#define N_BUILDER_ITEMS 8
+
+HPyDef_METH(tuple_builder, "tuple_builder", HPyFunc_O)
+static HPy tuple_builder_impl(HPyContext *ctx, HPy self, HPy arg)
+{
+    HPyTupleBuilder builder = HPyTupleBuilder_New(ctx, N_BUILDER_ITEMS);
+    for (HPy_ssize_t i = 0; i < N_BUILDER_ITEMS; i++)
+        HPyTupleBuilder_Set(ctx, builder, i, arg);
+    return HPyTupleBuilder_Build(ctx, builder);
+}
+
+HPyDef_METH(list_builder, "list_builder", HPyFunc_O)
+static HPy list_builder_impl(HPyContext *ctx, HPy self, HPy arg)
+{
+    HPyListBuilder builder = HPyListBuilder_New(ctx, N_BUILDER_ITEMS);
+    for (HPy_ssize_t i = 0; i < N_BUILDER_ITEMS; i++)
+        HPyListBuilder_Set(ctx, builder, i, arg);
+    return HPyListBuilder_Build(ctx, builder);
+}
+
+HPyDef_METH(unicode_as_utf8, "unicode_as_utf8", HPyFunc_O)
+static HPy unicode_as_utf8_impl(HPyContext *ctx, HPy self, HPy arg)
+{
+    HPy_ssize_t size;
+    if (HPyUnicode_AsUTF8AndSize(ctx, arg, &size) == NULL)
+        return HPy_NULL;
+    return HPy_Dup(ctx, ctx->h_None);
+}
+
+HPyDef_METH(getattr_s, "getattr_s", HPyFunc_O)
+static HPy getattr_s_impl(HPyContext *ctx, HPy self, HPy arg)
+{
+    return HPy_GetAttr_s(ctx, arg, "real");
+}
+
+/* the types are stored in globals by init_hpy_simple */
+static HPyGlobal g_Foo;
+static HPyGlobal g_Container;
+
+HPyDef_METH(global_load, "global_load", HPyFunc_NOARGS)
+static HPy global_load_impl(HPyContext *ctx, HPy self)
+{
+    return HPyGlobal_Load(ctx, g_Foo);
+}
+
+static HPy new_from_global(HPyContext *ctx, HPyGlobal g)
+{
+    void *data;
+    HPy cls = HPyGlobal_Load(ctx, g);
+    HPy h = HPy_New(ctx, cls, &data);
+    HPy_Close(ctx, cls);
+    return h;
+}
+
+HPyDef_METH(new_obj, "new_obj", HPyFunc_NOARGS)
+static HPy new_obj_impl(HPyContext *ctx, HPy self)
+{
+    return new_from_global(ctx, g_Foo);
+}
+
+HPyDef_METH(new_gc_obj, "new_gc_obj", HPyFunc_NOARGS)
+static HPy new_gc_obj_impl(HPyContext *ctx, HPy self)
+{
+    return new_from_global(ctx, g_Container);
+}
+
 
 /* Foo type */
 
@@ -79,6 +175,33 @@ static HPy_ssize_t Foo_len_impl(HPyContext *ctx, HPy self)
     return 42;
 }
 
+HPyDef_SLOT(Foo_richcompare, HPy_tp_richcompare)
+static HPy Foo_richcompare_impl(HPyContext *ctx, HPy self, HPy other, HPy_RichCmpOp op)
+{
+    return HPy_Dup(ctx, op == HPy_LT ? ctx->h_True : ctx->h_NotImplemented);
+}
+
+static char foo_buffer_data[16];
+static HPy_ssize_t foo_buffer_shape[] = { sizeof(foo_buffer_data) };
+static HPy_ssize_t foo_buffer_strides[] = { 1 };
+
+HPyDef_SLOT(Foo_getbuffer, HPy_bf_getbuffer)
+static int Foo_getbuffer_impl(HPyContext *ctx, HPy self, HPy_buffer *buf, int flags)
+{
+    buf->buf = foo_buffer_data;
+    buf->len = sizeof(foo_buffer_data);
+    buf->itemsize = 1;
+    buf->readonly = 1;
+    buf->ndim = 1;
+    buf->format = (char *)"B";
+    buf->shape = foo_buffer_shape;
+    buf->strides = foo_buffer_strides;
+    buf->suboffsets = NULL;
+    buf->internal = NULL;
+    buf->obj = HPy_Dup(ctx, self);
+    return 0;
+}
+
 
 // note that we can reuse the same HPyDef for both module-level and type-level
 // methods
@@ -90,6 +213,9 @@ static HPyDef *foo_defines[] = {
     &allocate_tuple,
     &Foo_getitem,
     &Foo_len,
+    &Foo_richcompare,
+    &Foo_getbuffer,
+    NULL
 };
 
 
@@ -101,6 +227,54 @@ static HPyType_Spec Foo_spec = {
 };
 
 
+/* Container type: a GC type with an HPyField */
+
+typedef struct {
+    HPyField item;
+} ContainerObject;
+
+HPyType_HELPERS(ContainerObject)
+
+HPyDef_SLOT(Container_traverse, HPy_tp_traverse)
+static int Container_traverse_impl(void *self, HPyFunc_visitproc visit, void *arg)
+{
+    ContainerObject *c = (ContainerObject *)self;
+    HPy_VISIT(&c->item);
+    return 0;
+}
+
+HPyDef_METH(Container_store, "store", HPyFunc_O)
+static HPy Container_store_impl(HPyContext *ctx, HPy self, HPy arg)
+{
+    ContainerObject *c = ContainerObject_AsStruct(ctx, self);
+    HPyField_Store(ctx, self, &c->item, arg);
+    return HPy_Dup(ctx, ctx->h_None);
+}
+
+HPyDef_METH(Container_load, "load", HPyFunc_NOARGS)
+static HPy Container_load_impl(HPyContext *ctx, HPy self)
+{
+    ContainerObject *c = ContainerObject_AsStruct(ctx, self);
+    if (HPyField_IsNull(c->item))
+        return HPy_Dup(ctx, ctx->h_None);
+    return HPyField_Load(ctx, self, c->item);
+}
+
+static HPyDef *container_defines[] = {
+    &Container_traverse,
+    &Container_store,
+    &Container_load,
+    NULL
+};
+
+static HPyType_Spec Container_spec = {
+    .name = "hpy_simple.Container",
+    .basicsize = sizeof(ContainerObject),
+    .flags = HPy_TPFLAGS_DEFAULT | HPy_TPFLAGS_HAVE_GC,
+    .defines = container_defines
+};
+
+
 /* Module defines */
 
 HPyDef_SLOT(init_hpy_simple, HPy_mod_exec)
@@ -111,9 +285,24 @@ static int init_hpy_simple_impl(HPyContext *ctx, HPy m)
         return -1;
     HPy_SetAttr_s(ctx, m, "Foo", h_Foo);
     HPy_SetAttr_s(ctx, m, "HTFoo", h_Foo);
+    HPyGlobal_Store(ctx, &g_Foo, h_Foo);
+    HPy_Close(ctx, h_Foo);
+
+    HPy h_Container = HPyType_FromSpec(ctx, &Container_spec, NULL);
+    if (HPy_IsNull(h_Container))
+        return -1;
+    HPy_SetAttr_s(ctx, m, "Container", h_Container);
+    HPyGlobal_Store(ctx, &g_Container, h_Container);
+    HPy_Close(ctx, h_Container);
     return 0;
 }
 
+static HPyGlobal *module_globals[] = {
+    &g_Foo,
+    &g_Container,
+    NULL
+};
+
 static HPyDef *module_defines[] = {
     &noargs,
     &onearg,
@@ -122,6 +311,16 @@ static HPyDef *module_defines[] = {
     &call_with_tuple_and_dict,
     &allocate_int,
     &allocate_tuple,
+    &parse_args,
+    &parse_args_kw,
+    &build_value_nested,
+    &tuple_builder,
+    &list_builder,
+    &unicode_as_utf8,
+    &getattr_s,
+    &global_load,
+    &new_obj,
+    &new_gc_obj,
     &init_hpy_simple,
     NULL
 };
@@ -130,6 +329,7 @@ static HPyModuleDef moduledef = {
     .doc = "HPy microbenchmarks",
     .size = 0,
     .defines = module_defines,
+    .globals = module_globals,
 };
 
 HPy_MODINIT(hpy_simple, moduledef)
@@ -8,13 +8,54 @@ import _valgrind
 
 API_PARAMS = [
     pytest.param('cpy', marks=pytest.mark.cpy),
-    pytest.param('hpy', marks=pytest.mark.hpy)
+    pytest.param('hpy', marks=pytest.mark.hpy),
+    pytest.param('hpy-debug', marks=pytest.mark.hpy_debug),
+    pytest.param('hpy-trace', marks=pytest.mark.hpy_trace),
     ]
 
 @pytest.fixture(params=API_PARAMS)
 def api(request):
     return request.param
 
+# hpy_simple loaded in debug or trace mode, {mode_name: module}
+_hpy_simple_modes = {}
+
+def load_hpy_simple(mode_name):
+    """
+    Load another instance of hpy_simple with the given HPy mode. This is
+    only possible if hpy_simple has been built with the universal ABI.
+
+    The shared library is copied first: loading the same file again would
+    return the already loaded library, whose global context would then be
+    replaced by the one of the new mode.
+    """
+    if mode_name in _hpy_simple_modes:
+        return _hpy_simple_modes[mode_name]
+    import atexit
+    import glob
+    import importlib.util
+    import os
+    import shutil
+    import tempfile
+    try:
+        import hpy.universal
+        mode = getattr(hpy.universal, mode_name)
+    except (ImportError, AttributeError):
+        pytest.skip('hpy.universal does not support %s' % mode_name)
+    spec = importlib.util.find_spec('hpy_simple')
+    so_files = glob.glob(os.path.join(os.path.dirname(spec.origin),
+                                      'hpy_simple.hpy*.so'))
+    if not so_files:
+        pytest.skip('hpy_simple was not built with the universal ABI')
+    tmpdir = tempfile.mkdtemp(prefix=mode_name.lower())
+    atexit.register(shutil.rmtree, tmpdir, ignore_errors=True)
+    so_filename = os.path.join(tmpdir, os.path.basename(so_files[0]))
+    shutil.copy(so_files[0], so_filename)
+    spec = importlib.util.spec_from_file_location('hpy_simple', so_filename)
+    mod = hpy.universal.load('hpy_simple', so_filename, spec, mode=mode)
+    _hpy_simple_modes[mode_name] = mod
+    return mod
+
 @pytest.fixture
 def simple(request, api):
     if api == 'cpy':
@@ -23,6 +64,10 @@ def simple(request, api):
     elif api == 'hpy':
         import hpy_simple
         return hpy_simple
+    elif api == 'hpy-debug':
+        return load_hpy_simple('MODE_DEBUG')
+    elif api == 'hpy-trace':
+        return load_hpy_simple('MODE_TRACE')
     else:
         assert False, 'Unkown param: %s' % request.param
 
@@ -86,6 +131,60 @@ class TestModule:
             for i in range(N):
                 simple.allocate_tuple()
 
+    def test_parse_args(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.parse_args(1, 2, 3.0)
+
+    def test_parse_args_kw(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.parse_args_kw(1, b=2, c=3.0)
+
+    def test_build_value_nested(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.build_value_nested()
+
+    def test_tuple_builder(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.tuple_builder(None)
+
+    def test_list_builder(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.list_builder(None)
+
+    def test_unicode_as_utf8(self, simple, timer, N):
+        s = 'hello world'
+        with timer:
+            for i in range(N):
+                simple.unicode_as_utf8(s)
+
+    def test_getattr_s(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.getattr_s(i)
+
+    def test_global_load(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.global_load()
+
+    def test_new_obj(self, simple, timer, N):
+        with timer:
+            for i in range(N):
+                simple.new_obj()
+
+    def test_new_gc_obj(self, simple, timer, N):
+        import gc
+        gc.collect()
+        with timer:
+            for i in range(N):
+                simple.new_gc_obj()
+            gc.collect()
+
 
 class TestType:
     """ Compares the performance of operations on types.
@@ -164,6 +263,31 @@ class TestType:
             for i in range(N):
                 obj[0]
 
+    def test_richcompare(self, simple, timer, N):
+        obj = simple.Foo()
+        with timer:
+            for i in range(N):
+                obj < i
+
+    def test_getbuffer(self, simple, timer, N):
+        obj = simple.Foo()
+        with timer:
+            for i in range(N):
+                memoryview(obj)
+
+    def test_field_store(self, simple, timer, N):
+        obj = simple.Container()
+        with timer:
+            for i in range(N):
+                obj.store(i)
+
+    def test_field_load(self, simple, timer, N):
+        obj = simple.Container()
+        obj.store(obj)
+        with timer:
+            for i in range(N):
+                obj.load()
+
 
 class TestHeapType:
     """ Compares the performance of operations on heap types.
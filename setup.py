@@ -102,9 +102,12 @@ HPY_EXTRA_SOURCES = [
 ]
 
 HPY_CTX_SOURCES = [
+    'hpy/devel/src/runtime/ctx_buffer.c',
     'hpy/devel/src/runtime/ctx_bytes.c',
     'hpy/devel/src/runtime/ctx_call.c',
     'hpy/devel/src/runtime/ctx_capsule.c',
+    'hpy/devel/src/runtime/ctx_dict.c',
+    'hpy/devel/src/runtime/ctx_dictbuilder.c',
     'hpy/devel/src/runtime/ctx_err.c',
     'hpy/devel/src/runtime/ctx_eval.c',
     'hpy/devel/src/runtime/ctx_long.c',
@@ -213,11 +216,14 @@ EXT_MODULES = [
                'hpy/debug/src/debug_ctx_cpython.c',
                'hpy/debug/src/debug_handles.c',
                'hpy/debug/src/dhqueue.c',
+               'hpy/debug/src/dhslab.c',
+               'hpy/debug/src/dhrawpool.c',
                'hpy/debug/src/memprotect.c',
                'hpy/debug/src/stacktrace.c',
                'hpy/debug/src/_debugmod.c',
                'hpy/debug/src/autogen_debug_wrappers.c',
                'hpy/trace/src/trace_ctx.c',
+               'hpy/trace/src/trace_events.c',
                'hpy/trace/src/_tracemod.c',
                'hpy/trace/src/autogen_trace_wrappers.c',
                'hpy/trace/src/autogen_trace_func_table.c']
@@ -15,15 +15,19 @@ def test_correct_usage(compiler, hpy_debug_capture):
         {
             HPyTupleBuilder tbuilder = HPyTupleBuilder_New(ctx, nargs);
             HPyListBuilder lbuilder = HPyListBuilder_New(ctx, nargs);
+            HPyDictBuilder dbuilder = HPyDictBuilder_New(ctx, nargs);
             for (size_t i=0; i < nargs; i++) {
                 HPyTupleBuilder_Set(ctx, tbuilder, i, args[i]);
                 HPyListBuilder_Set(ctx, lbuilder, i, args[i]);
+                HPyDictBuilder_Set(ctx, dbuilder, args[i], args[i]);
             }
             HPy t = HPyTupleBuilder_Build(ctx, tbuilder);
             HPy l = HPyListBuilder_Build(ctx, lbuilder);
-            HPy h_result = HPyTuple_Pack(ctx, 2, t, l);
+            HPy d = HPyDictBuilder_Build(ctx, dbuilder);
+            HPy h_result = HPyTuple_Pack(ctx, 3, t, l, d);
             HPy_Close(ctx, t);
             HPy_Close(ctx, l);
+            HPy_Close(ctx, d);
             return h_result;
         }
         
@@ -32,19 +36,23 @@ def test_correct_usage(compiler, hpy_debug_capture):
         {
             HPyTupleBuilder tbuilder = HPyTupleBuilder_New(ctx, nargs);
             HPyListBuilder lbuilder = HPyListBuilder_New(ctx, nargs);
+            HPyDictBuilder dbuilder = HPyDictBuilder_New(ctx, nargs);
             for (size_t i=0; i < nargs; i++) {
                 HPyTupleBuilder_Set(ctx, tbuilder, i, args[i]);
                 HPyListBuilder_Set(ctx, lbuilder, i, args[i]);
+                HPyDictBuilder_Set_s(ctx, dbuilder, "x", args[i]);
             }
             HPyTupleBuilder_Cancel(ctx, tbuilder);
             HPyListBuilder_Cancel(ctx, lbuilder);
+            HPyDictBuilder_Cancel(ctx, dbuilder);
             return HPy_Dup(ctx, ctx->h_None);
         }
         @EXPORT(build)
         @EXPORT(cancel)
         @INIT
         """)
-    assert mod.build('hello', 42, None) == (('hello', 42, None), ['hello', 42, None])
+    assert mod.build('hello', 42, None) == (('hello', 42, None), ['hello', 42, None],
+                                            {'hello': 'hello', 42: 42, None: None})
     assert mod.cancel('hello', 42, None) is None
     assert hpy_debug_capture.invalid_builders_count == 0
 
@@ -146,3 +154,36 @@ def test_build_cancel_after_build(compiler, hpy_debug_capture):
     mod.f('hello', 42, None)
     mod.g('hello', 42, None)
     assert hpy_debug_capture.invalid_builders_count == 2
+
+
+def test_dictbuilder_invalid(compiler, hpy_debug_capture):
+    mod = compiler.make_module("""
+        HPyDef_METH(f, "f", HPyFunc_VARARGS)
+        static HPy f_impl(HPyContext *ctx, HPy h_self, const HPy *args, size_t nargs)
+        {
+            HPyDictBuilder builder = HPyDictBuilder_New(ctx, nargs);
+            for (size_t i=0; i < nargs; i++)
+                HPyDictBuilder_Set(ctx, builder, args[i], args[i]);
+            HPy h_result = HPyDictBuilder_Build(ctx, builder);
+            HPy_Close(ctx, h_result);
+            return HPyDictBuilder_Build(ctx, builder);
+        }
+        HPyDef_METH(g, "g", HPyFunc_VARARGS)
+        static HPy g_impl(HPyContext *ctx, HPy h_self, const HPy *args, size_t nargs)
+        {
+            HPyDictBuilder builder = HPyDictBuilder_New(ctx, nargs);
+            HPyDictBuilder_Cancel(ctx, builder);
+            // Set on a closed builder is ignored, like the build function
+            if (HPyDictBuilder_Set_s(ctx, builder, "x", ctx->h_None) < 0)
+                return HPy_NULL;
+            return HPy_Dup(ctx, ctx->h_None);
+        }
+        @EXPORT(f)
+        @EXPORT(g)
+        @INIT
+        """)
+    with pytest.raises(MemoryError):
+        mod.f('hello', 42, None)
+    assert hpy_debug_capture.invalid_builders_count == 1
+    assert mod.g('hello') is None
+    assert hpy_debug_capture.invalid_builders_count == 2
@@ -298,3 +298,80 @@ def test_charptr_limit_stress_test(compiler):
     finally:
         _debug.set_protected_raw_data_max_size(old_raw_data_max_size)
         _debug.set_closed_handles_queue_max_size(old_closed_handles_max_size)
+
+
+def test_charptr_raw_data_pool(compiler):
+    import hpy.debug
+    from hpy.universal import _debug
+    mod = compiler.make_module("""
+        HPyDef_METH(f, "f", HPyFunc_O)
+        static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+        {
+            HPy_ssize_t size;
+            const char *data = HPyUnicode_AsUTF8AndSize(ctx, arg, &size);
+            if (data == NULL)
+                return HPy_NULL;
+            return HPyUnicode_FromString(ctx, data);
+        }
+
+        @EXPORT(f)
+        @INIT
+    """)
+
+    def pool_used():
+        return _debug.get_slab_stats()['raw_data_pool']['used']
+
+    assert _debug.get_raw_data_pool_max_size() == 0
+    with pytest.raises(ValueError):
+        _debug.set_raw_data_pool_max_size(1024 * 1024)
+    with pytest.raises(ValueError):
+        _debug.set_raw_data_pool_max_size(-1)
+    with pytest.raises(ValueError):
+        _debug.set_raw_data_sample_period(-1)
+    assert _debug.get_raw_data_pool_max_size() == 0
+    assert _debug.get_raw_data_sample_period() == 0
+    hpy.debug.enable_raw_data_pool(64)
+    try:
+        assert _debug.get_raw_data_pool_max_size() == 64
+        used = pool_used()
+        for i in range(10):
+            assert mod.f('small %d' % i) == 'small %d' % i
+        assert pool_used() > used
+        # large strings are always page protected
+        used = pool_used()
+        assert mod.f('x' * 100) == 'x' * 100
+        assert pool_used() == used
+        # with a sample period of 1, all the copies are page protected
+        hpy.debug.enable_raw_data_pool(64, sample_period=1)
+        assert _debug.get_raw_data_sample_period() == 1
+        for i in range(10):
+            assert mod.f('small %d' % i) == 'small %d' % i
+        assert pool_used() == used
+    finally:
+        hpy.debug.disable_raw_data_pool()
+        _debug.set_raw_data_sample_period(0)
+
+
+@pytest.mark.skipif(not SUPPORTS_SYS_EXECUTABLE, reason="needs subprocess")
+def test_charptr_raw_data_pool_write_ptr(compiler, python_subprocess):
+    mod = compiler.compile_module("""
+        HPyDef_METH(f, "f", HPyFunc_O)
+        static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+        {
+            HPy arg_dup = HPy_Dup(ctx, arg);
+            HPy_ssize_t size;
+            char *data = (char *)HPyUnicode_AsUTF8AndSize(ctx, arg_dup, &size);
+            // write to read-only memory: detected when the handle is closed
+            data[0] = 'a';
+            HPy_Close(ctx, arg_dup);
+            return HPy_Dup(ctx, ctx->h_None);
+        }
+
+        @EXPORT(f)
+        @INIT
+    """)
+    code = ("import hpy.debug; hpy.debug.enable_raw_data_pool(); "
+            "mod.f('try writing me!')")
+    result = python_subprocess.run(mod, code)
+    assert result.returncode != 0
+    assert b"Invalid write to the read-only data" in result.stderr
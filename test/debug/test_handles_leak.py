@@ -228,6 +228,27 @@ def test_closed_handles_queue_max_size(compiler):
     finally:
         _debug.set_closed_handles_queue_max_size(old_size)
 
+def test_slab_stats(compiler):
+    from hpy.universal import _debug
+    mod = make_leak_module(compiler)
+    def check_handles():
+        # every DebugHandle is either open or in the closed handles queue
+        stats = _debug.get_slab_stats()['handles']
+        n = len(_debug.get_open_handles(0)) + len(_debug.get_closed_handles())
+        assert stats['used'] == n
+        assert stats['used'] <= stats['capacity']
+        assert stats['chunks'] > 0
+        return stats
+    stats1 = check_handles()
+    for i in range(1000):
+        mod.leak(i)
+    stats2 = check_handles()
+    assert stats2['used'] >= stats1['used'] + 1000
+    assert stats2['capacity'] > stats1['capacity']
+    #
+    stats = _debug.get_slab_stats()['builders']
+    assert 0 <= stats['used'] <= stats['capacity']
+
 def test_reuse_closed_handles(compiler):
     from hpy.universal import _debug
     mod = compiler.make_module("""
@@ -177,3 +177,46 @@ def test_unicode_substring(compiler, python_subprocess):
     result = python_subprocess.run(mod, "mod.f(b'hello', 2, 3)")
     assert result.returncode != 0
     assert "HPyUnicode_Substring arg 1 must be a Unicode object" in result.stderr.decode("utf-8")
+
+
+def test_buffer_not_released(compiler):
+    from hpy.universal import _debug
+    mod = compiler.make_module("""
+        HPyDef_METH(f, "f", HPyFunc_O)
+        static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+        {
+            HPy_buffer view;
+            if (HPy_GetBuffer(ctx, arg, &view, HPyBUF_SIMPLE) < 0)
+                return HPy_NULL;
+            // missing HPyBuffer_Release
+            return HPy_Dup(ctx, ctx->h_None);
+        }
+        @EXPORT(f)
+        @INIT
+    """)
+    gen = _debug.new_generation()
+    b = bytearray(b'hello')
+    mod.f(b)
+    assert [dh.obj for dh in _debug.get_open_handles(gen)] == [b]
+
+
+@pytest.mark.skipif(not SUPPORTS_SYS_EXECUTABLE, reason="needs subprocess")
+def test_buffer_released_twice(compiler, python_subprocess):
+    mod = compiler.compile_module("""
+        HPyDef_METH(f, "f", HPyFunc_O)
+        static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+        {
+            HPy_buffer view;
+            if (HPy_GetBuffer(ctx, arg, &view, HPyBUF_SIMPLE) < 0)
+                return HPy_NULL;
+            HPyBuffer_Release(ctx, &view);
+            HPyBuffer_Release(ctx, &view);
+            return HPy_Dup(ctx, ctx->h_None);
+        }
+        @EXPORT(f)
+        @INIT
+    """)
+    result = python_subprocess.run(mod, "mod.f(b'hello')")
+    assert result.returncode != 0
+    assert ("HPyBuffer_Release called on a view which was already released"
+            in result.stderr.decode("utf-8"))
@@ -41,8 +41,9 @@ class TestBasic(HPyTest):
             """)
         except RuntimeError as ex:
             assert str(ex) == "HPy extension module 'mytest' requires unsupported " \
-                              "version of the HPy runtime. Requested version: 999.0. " \
-                              "Current HPy version: {}.{}.".format(HPY_ABI_VERSION, HPY_ABI_VERSION_MINOR)
+                              "version of the HPy runtime. Requested version: 999.{}. " \
+                              "Current HPy version: {}.{}.".format(HPY_ABI_VERSION_MINOR,
+                                                                  HPY_ABI_VERSION, HPY_ABI_VERSION_MINOR)
         else:
             assert False, "Expected exception"
 
@@ -180,6 +181,39 @@ class TestBasic(HPyTest):
         """)
         assert mod.f(41.5) == 42.5
 
+    def test_close_many_dup_many(self):
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_VARARGS)
+            static HPy f_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+            {
+                HPy borrowed[5], owned[5];
+                if (nargs > 4) {
+                    HPyErr_SetString(ctx, ctx->h_TypeError, "too many args");
+                    return HPy_NULL;
+                }
+                for (size_t i = 0; i < nargs; i++)
+                    borrowed[i] = args[i];
+                borrowed[nargs] = HPy_NULL;
+                HPy_DupMany(ctx, borrowed, owned, nargs + 1);
+                /* the arrays may be the same */
+                HPy_DupMany(ctx, borrowed, borrowed, nargs + 1);
+                HPy res = HPyTuple_FromArray(ctx, owned, nargs);
+                HPy_CloseMany(ctx, owned, nargs + 1);
+                HPy_CloseMany(ctx, borrowed, nargs + 1);
+                HPy_CloseMany(ctx, borrowed, 0);
+                return res;
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+        import sys
+        obj = object()
+        refcnt = sys.getrefcount(obj)
+        assert mod.f() == ()
+        assert mod.f(1, 'a', obj) == (1, 'a', obj)
+        if self.supports_refcounts():
+            assert sys.getrefcount(obj) == refcnt
+
     def test_bool(self):
         mod = self.make_module("""
             HPyDef_METH(f, "f", HPyFunc_O)
@@ -232,6 +266,28 @@ class TestBasic(HPyTest):
         """)
         assert mod.f(4, 5) == 45
 
+    def test_varargs_many(self):
+        # exercise both the small and the large number of arguments paths of
+        # the trampoline
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_VARARGS)
+            static HPy f_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+            {
+                long result = 0;
+                for (size_t i = 0; i < nargs; i++) {
+                    result = 10 * result + HPyLong_AsLong(ctx, args[i]);
+                }
+                return HPyLong_FromLong(ctx, result);
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+        assert mod.f() == 0
+        assert mod.f(1) == 1
+        assert mod.f(1, 2, 3, 4) == 1234
+        assert mod.f(1, 2, 3, 4, 5) == 12345
+        assert mod.f(*range(1, 10)) == 123456789
+
     def test_builtin_handles(self):
         mod = self.make_module("""
             HPyDef_METH(f, "f", HPyFunc_O)
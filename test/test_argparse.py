@@ -428,6 +428,38 @@ class TestArgParse(HPyTest):
             mod.f(1, 2)
         assert str(exc.value) == "my-error-message"
 
+    def test_plan(self):
+        import pytest
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_VARARGS)
+            static HPy f_impl(HPyContext *ctx, HPy self,
+                              const HPy *args, size_t nargs)
+            {
+                HPy a, result;
+                long b = 5;
+                HPyTracker ht;
+                static HPyArg_ParsePlan plan = { "O|l:f" };
+                if (!HPyArg_ParseWithPlan(ctx, &ht, args, nargs, &plan, &a, &b))
+                    return HPy_NULL;
+                result = HPyLong_FromLong(ctx, HPyLong_AsLong(ctx, a) + b);
+                HPyTracker_Close(ctx, ht);
+                return result;
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+        for i in range(2):
+            assert mod.f(1) == 6
+            assert mod.f(3, 4) == 7
+            with pytest.raises(TypeError) as exc:
+                mod.f()
+            assert str(exc.value) == "f() required positional argument missing"
+            with pytest.raises(TypeError) as exc:
+                mod.f(1, 2, 3)
+            assert str(exc.value) == "f() mismatched args (too many arguments for fmt)"
+            with pytest.raises(TypeError):
+                mod.f(1, "b")
+
 
 class TestArgParseKeywords(HPyTest):
     def make_two_arg_add(self, fmt="O+O+"):
@@ -676,3 +708,160 @@ class TestArgParseKeywords(HPyTest):
         assert mod.f((3,), {}) == 8
         with pytest.raises(TypeError):
             mod.f(tuple(), {})
+
+    def make_parser_add(self, fmt="OO", kwlist='"a", "b"'):
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_KEYWORDS)
+            static HPy f_impl(HPyContext *ctx, HPy self,
+                              const HPy *args, size_t nargs, HPy kwnames)
+            {{
+                HPy a, b = HPy_NULL, result;
+                HPyTracker ht;
+                static const char *kwlist[] = {{ {kwlist}, NULL }};
+                static HPyArg_KeywordsParser parser = {{ "{fmt}", kwlist }};
+                if (!HPyArg_ParseKeywordsWithParser(ctx, &ht, args, nargs,
+                                                    kwnames, &parser, &a, &b)) {{
+                    return HPy_NULL;
+                }}
+                if (HPy_IsNull(b)) {{
+                    b = HPyLong_FromLong(ctx, 5);
+                    HPyTracker_Add(ctx, ht, b);
+                }}
+                result = HPy_Add(ctx, a, b);
+                HPyTracker_Close(ctx, ht);
+                return result;
+            }}
+            @EXPORT(f)
+            @INIT
+        """.format(fmt=fmt, kwlist=kwlist))
+        return mod
+
+    def test_parser(self):
+        mod = self.make_parser_add("O|O")
+        # call several times to exercise both the slow and the fast path
+        for i in range(3):
+            assert mod.f(1, 2) == 3
+            assert mod.f(1, b=2) == 3
+            assert mod.f(b=2, a=1) == 3
+            assert mod.f(a=1) == 6
+            assert mod.f(1) == 6
+
+    def test_parser_non_interned_keywords(self):
+        # build the keyword names at runtime, so that they are not interned
+        mod = self.make_parser_add("O|O")
+        a = ''.join(['a'])
+        b = ''.join(['b'])
+        for i in range(3):
+            assert mod.f(**{a: 1, b: 2}) == 3
+            assert mod.f(b=2, a=1) == 3
+            assert mod.f(1, **{b: 2}) == 3
+
+    def test_parser_positional_only_and_errors(self):
+        import pytest
+        mod = self.make_parser_add("O|O:my_func", kwlist='"", "b"')
+        assert mod.f(1, b=2) == 3
+        assert mod.f(1) == 6
+        with pytest.raises(TypeError) as exc:
+            mod.f(a=1, b=2)
+        assert str(exc.value) == "my_func() no value for required argument"
+
+    def test_parser_blank_keyword_argument_exception(self):
+        import pytest
+        mod = self.make_parser_add("OO", kwlist='"a", ""')
+        for i in range(2):
+            with pytest.raises(SystemError) as exc:
+                mod.f(1, 2)
+            assert str(exc.value) == "function empty keyword parameter name"
+
+
+class TestMethKw(HPyTest):
+    def make_kw_add(self):
+        mod = self.make_module("""
+            static const char *f_kwlist[] = { "a", "b", NULL };
+            HPyDef_METH_KW(f, "f", f_kwlist)
+            static HPy f_impl(HPyContext *ctx, HPy self,
+                              const HPy *args, size_t nargs)
+            {
+                if (nargs != 2) {
+                    HPyErr_SetString(ctx, ctx->h_SystemError, "wrong nargs");
+                    return HPy_NULL;
+                }
+                if (HPy_IsNull(args[0])) {
+                    HPyErr_SetString(ctx, ctx->h_TypeError,
+                                     "f() missing required argument 'a'");
+                    return HPy_NULL;
+                }
+                if (HPy_IsNull(args[1]))
+                    return HPy_Dup(ctx, args[0]);
+                return HPy_Add(ctx, args[0], args[1]);
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+        return mod
+
+    def test_positional_and_keywords(self):
+        mod = self.make_kw_add()
+        # call several times to check that the table is reused
+        for i in range(3):
+            assert mod.f(1, 2) == 3
+            assert mod.f("x", b="y") == "xy"
+            assert mod.f(b="y", a="x") == "xy"
+            assert mod.f(a=5) == 5
+            assert mod.f(5) == 5
+
+    def test_non_interned_keywords(self):
+        mod = self.make_kw_add()
+        a = ''.join(['a'])
+        b = ''.join(['b'])
+        assert mod.f(**{b: "y", a: "x"}) == "xy"
+        assert mod.f("x", **{b: "y"}) == "xy"
+
+    def test_errors(self):
+        import pytest
+        mod = self.make_kw_add()
+        with pytest.raises(TypeError) as exc:
+            mod.f()
+        assert str(exc.value) == "f() missing required argument 'a'"
+        with pytest.raises(TypeError) as exc:
+            mod.f(1, 2, 3)
+        assert str(exc.value) == "f() takes at most 2 arguments (3 given)"
+        with pytest.raises(TypeError) as exc:
+            mod.f(1, c=3)
+        assert str(exc.value) == "f() got an unexpected keyword argument 'c'"
+        with pytest.raises(TypeError) as exc:
+            mod.f(1, a=3)
+        assert str(exc.value) == "f() got multiple values for argument 'a'"
+
+    def test_method(self):
+        mod = self.make_module("""
+            static const char *scale_kwlist[] = { "x", "factor", NULL };
+            HPyDef_METH_KW(scale, "scale", scale_kwlist,
+                           .doc = "scale(x, factor=2)")
+            static HPy scale_impl(HPyContext *ctx, HPy self,
+                                  const HPy *args, size_t nargs)
+            {
+                long factor = 2;
+                if (HPy_IsNull(args[0])) {
+                    HPyErr_SetString(ctx, ctx->h_TypeError, "missing x");
+                    return HPy_NULL;
+                }
+                if (!HPy_IsNull(args[1]))
+                    factor = HPyLong_AsLong(ctx, args[1]);
+                return HPyLong_FromLong(ctx,
+                                        HPyLong_AsLong(ctx, args[0]) * factor);
+            }
+
+            static HPyDef *Dummy_defines[] = { &scale, NULL };
+            static HPyType_Spec Dummy_spec = {
+                .name = "mytest.Dummy",
+                .defines = Dummy_defines,
+            };
+            @EXPORT_TYPE("Dummy", Dummy_spec)
+            @INIT
+        """)
+        d = mod.Dummy()
+        assert d.scale(21) == 42
+        assert d.scale(factor=3, x=5) == 15
+        assert d.scale(5, factor=10) == 50
+        assert mod.Dummy.scale.__doc__ == "scale(x, factor=2)"
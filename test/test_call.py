@@ -307,6 +307,90 @@ class TestCall(HPyTest):
             with pytest.raises(AttributeError):
                 mod.call('embedded null byte', test_obj, *args, **kwd)
 
+    def test_hpy_callmethodcached(self):
+        import pytest
+        mod = self.make_module("""
+            static HPyCallSite append_site = { "append", NULL };
+            static const char *split_kwnames[] = { "sep", "maxsplit", NULL };
+            static HPyCallSite split_site = { "split", split_kwnames };
+            static HPyCallSite f_site = { "f", NULL };
+
+            HPyDef_METH(append, "append", HPyFunc_VARARGS)
+            static HPy append_impl(HPyContext *ctx, HPy self,
+                                   const HPy *args, size_t nargs)
+            {
+                return HPy_CallMethodCached(ctx, &append_site, args, nargs);
+            }
+
+            HPyDef_METH(split, "split", HPyFunc_VARARGS)
+            static HPy split_impl(HPyContext *ctx, HPy self,
+                                  const HPy *args, size_t nargs)
+            {
+                // (receiver, sep, maxsplit), all passed as keywords
+                if (nargs != 3) {
+                    HPyErr_SetString(ctx, ctx->h_TypeError, "expected 3 args");
+                    return HPy_NULL;
+                }
+                return HPy_CallMethodCached(ctx, &split_site, args, 1);
+            }
+
+            HPyDef_METH(f, "f", HPyFunc_VARARGS)
+            static HPy f_impl(HPyContext *ctx, HPy self,
+                              const HPy *args, size_t nargs)
+            {
+                return HPy_CallMethodCached(ctx, &f_site, args, nargs);
+            }
+            @EXPORT(append)
+            @EXPORT(split)
+            @EXPORT(f)
+            @INIT
+        """)
+        # monomorphic site: the method of list is cached after the first call
+        lst = []
+        for i in range(5):
+            assert mod.append(lst, i) is None
+        assert lst == [0, 1, 2, 3, 4]
+        with pytest.raises(TypeError):
+            mod.append(lst)
+        with pytest.raises(AttributeError):
+            mod.append(42, 1)
+
+        # keyword arguments are taken from the site
+        assert mod.split('a,b,c', ',', 1) == ['a', 'b,c']
+        assert mod.split('a b  c', None, -1) == ['a', 'b', 'c']
+        assert mod.split(b'a,b', b',', -1) == [b'a', b'b']
+
+        class A:
+            __slots__ = ()
+            def f(self, x):
+                return ('A', x)
+
+        class B:
+            __slots__ = ()
+            def f(self, x):
+                return ('B', x)
+
+        class D:
+            def f(self, x):
+                return ('D', x)
+
+        a = A()
+        # polymorphic receivers
+        for i in range(3):
+            assert mod.f(a, i) == ('A', i)
+            assert mod.f(B(), i) == ('B', i)
+        # modifying the type invalidates the cache
+        A.f = lambda self, x: ('new A', x)
+        assert mod.f(a, 1) == ('new A', 1)
+        del A.f
+        with pytest.raises(AttributeError):
+            mod.f(a, 1)
+        # the instance dict is honored
+        d = D()
+        assert mod.f(d, 1) == ('D', 1)
+        d.f = lambda x: ('instance', x)
+        assert mod.f(d, 1) == ('instance', 1)
+
     def test_hpycallable_check(self):
         mod = self.make_module("""
             HPyDef_METH(f, "f", HPyFunc_O)
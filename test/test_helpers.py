@@ -142,3 +142,81 @@ class TestHPyModuleAddType(HPyTest):
                 mod.pack_error(mode)
         with pytest.raises(TypeError):
             mod.pack_error(3)
+
+    def test_forward_call(self):
+        mod = self.make_module("""
+            HPyDef_METH(forward, "forward", HPyFunc_KEYWORDS)
+            static HPy forward_impl(HPyContext *ctx, HPy self, const HPy *args,
+                                    size_t nargs, HPy kwnames)
+            {
+                // forward(callable, first, *args, **kwargs)
+                HPy first = HPy_Is(ctx, args[1], ctx->h_None) ? HPy_NULL : args[1];
+                return HPyHelpers_ForwardCall(ctx, args[0], first, args + 2,
+                                              nargs - 2, kwnames);
+            }
+
+            @EXPORT(forward)
+            @INIT
+        """)
+        def f(*args, **kwargs):
+            return args, kwargs
+        assert mod.forward(f, None) == ((), {})
+        assert mod.forward(f, None, 1, 2, a=3) == ((1, 2), {'a': 3})
+        assert mod.forward(f, 'self') == (('self',), {})
+        assert mod.forward(f, 'self', 1, b=2, c=3) == (('self', 1), {'b': 2, 'c': 3})
+        many = tuple(range(20))
+        kw = {'k%d' % i: i for i in range(10)}
+        assert mod.forward(f, 'self', *many, **kw) == (('self',) + many, kw)
+
+    def test_kwargs_view(self):
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_KEYWORDS)
+            static HPy f_impl(HPyContext *ctx, HPy self, const HPy *args,
+                              size_t nargs, HPy kwnames)
+            {
+                // return (size, value of 'x' or None, kwargs dict or None)
+                HPyKwargsView kw;
+                HPy items[3], kwd, result;
+                int r;
+                if (!HPyKwargsView_Init(ctx, &kw, args, nargs, kwnames))
+                    return HPy_NULL;
+                items[0] = HPyLong_FromSsize_t(ctx, HPyKwargsView_Size(&kw));
+                r = HPyKwargsView_Get_s(ctx, &kw, "x", &items[1]);
+                if (r < 0)
+                    goto error;
+                if (r == 0)
+                    items[1] = ctx->h_None;
+                if (nargs > 0 && HPy_IsTrue(ctx, args[0])) {
+                    if (!HPyKwargsView_AsDict(ctx, &kw, &kwd))
+                        goto error;
+                    // the dict is created only once
+                    HPy kwd2;
+                    if (!HPyKwargsView_AsDict(ctx, &kw, &kwd2))
+                        goto error;
+                    if (!HPy_Is(ctx, kwd, kwd2)) {
+                        HPyErr_SetString(ctx, ctx->h_AssertionError, "not cached");
+                        goto error;
+                    }
+                    items[2] = HPy_IsNull(kwd) ? ctx->h_None : kwd;
+                }
+                else {
+                    items[2] = ctx->h_None;
+                }
+                result = HPyTuple_FromArray(ctx, items, 3);
+                HPy_Close(ctx, items[0]);
+                HPyKwargsView_Close(ctx, &kw);
+                return result;
+            error:
+                HPy_Close(ctx, items[0]);
+                HPyKwargsView_Close(ctx, &kw);
+                return HPy_NULL;
+            }
+
+            @EXPORT(f)
+            @INIT
+        """)
+        assert mod.f() == (0, None, None)
+        assert mod.f(True) == (0, None, None)
+        assert mod.f(False, y=1) == (1, None, None)
+        assert mod.f(False, y=1, x=2) == (2, 2, None)
+        assert mod.f(True, y=1, x=2) == (2, 2, {'x': 2, 'y': 1})
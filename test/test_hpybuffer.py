@@ -0,0 +1,105 @@
+import pytest
+from .support import HPyTest
+
+
+class TestBuffer(HPyTest):
+
+    def test_GetBuffer(self):
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_O)
+            static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+            {
+                HPy_buffer view;
+                if (HPy_GetBuffer(ctx, arg, &view, HPyBUF_RECORDS_RO) < 0)
+                    return HPy_NULL;
+                long sum = 0;
+                for (HPy_ssize_t i = 0; i < view.len; i++)
+                    sum += ((unsigned char *)view.buf)[i];
+                HPy h_is_exporter = HPy_Is(ctx, view.obj, arg) ?
+                                        ctx->h_True : ctx->h_False;
+                HPy result = HPy_BuildValue(ctx, "nlsiO", view.len, sum,
+                                            view.format, view.readonly,
+                                            h_is_exporter);
+                HPyBuffer_Release(ctx, &view);
+                return result;
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+        import array
+        assert mod.f(b'abc') == (3, 294, 'B', 1, True)
+        assert mod.f(bytearray(b'\x01\x02')) == (2, 3, 'B', 0, True)
+        assert mod.f(array.array('i', [1])) == (4, 1, 'i', 0, True)
+        mv = memoryview(b'xyz')
+        assert mod.f(mv) == (3, 363, 'B', 1, True)
+        with pytest.raises(TypeError):
+            mod.f(42)
+
+    def test_GetBuffer_writable(self):
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_O)
+            static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+            {
+                HPy_buffer view;
+                if (HPy_GetBuffer(ctx, arg, &view, HPyBUF_WRITABLE) < 0)
+                    return HPy_NULL;
+                for (HPy_ssize_t i = 0; i < view.len; i++)
+                    ((char *)view.buf)[i] += 1;
+                HPyBuffer_Release(ctx, &view);
+                return HPy_Dup(ctx, ctx->h_None);
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+        b = bytearray(b'abc')
+        mod.f(b)
+        assert b == b'bcd'
+        with pytest.raises(BufferError):
+            mod.f(b'abc')
+        # the view is released, so the bytearray can be resized again
+        b.append(0)
+        assert b == b'bcd\x00'
+
+    def test_contiguous_or_copy(self):
+        mod = self.make_module("""
+            #include <stdlib.h>
+
+            HPyDef_METH(f, "f", HPyFunc_O)
+            static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+            {
+                HPy_buffer view;
+                if (HPy_GetBuffer(ctx, arg, &view, HPyBUF_STRIDED_RO) < 0)
+                    return HPy_NULL;
+                int contiguous = HPyBuffer_IsContiguous(ctx, &view, 'C');
+                const char *data = view.buf;
+                char *copy = NULL;
+                if (!contiguous) {
+                    copy = (char *)malloc(view.len);
+                    if (copy == NULL) {
+                        HPyBuffer_Release(ctx, &view);
+                        return HPyErr_NoMemory(ctx);
+                    }
+                    if (HPyBuffer_ToContiguous(ctx, copy, &view, view.len, 'C') < 0) {
+                        free(copy);
+                        HPyBuffer_Release(ctx, &view);
+                        return HPy_NULL;
+                    }
+                    data = copy;
+                }
+                HPy h_data = HPyBytes_FromStringAndSize(ctx, data, view.len);
+                free(copy);
+                HPyBuffer_Release(ctx, &view);
+                if (HPy_IsNull(h_data))
+                    return HPy_NULL;
+                HPy result = HPy_BuildValue(ctx, "Oi", h_data, contiguous);
+                HPy_Close(ctx, h_data);
+                return result;
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+        assert mod.f(b'abcdef') == (b'abcdef', 1)
+        mv = memoryview(b'abcdef')
+        assert mod.f(mv[1:4]) == (b'bcd', 1)
+        assert mod.f(mv[::2]) == (b'ace', 0)
+        assert mod.f(mv[::-1]) == (b'fedcba', 0)
@@ -1,6 +1,18 @@
+import re
 from .support import HPyTest
 
 
+def with_plan(code):
+    # turn 'return HPy_BuildValue(ctx, "fmt", ...);' into the equivalent code
+    # which uses a static HPy_BuildValuePlan
+    m = re.match(r'return HPy_BuildValue\(ctx, ("[^"]*")(.*)\);$', code)
+    assert m, code
+    fmt, args = m.groups()
+    return ('{{ static HPy_BuildValuePlan plan = {{ {fmt} }}; '
+            'return HPy_BuildValueWithPlan(ctx, &plan{args}); }}'
+            .format(fmt=fmt, args=args))
+
+
 class TestBuildValue(HPyTest):
 
     def make_tests_module(self, test_cases):
@@ -27,7 +39,7 @@ class TestBuildValue(HPyTest):
             @INIT
         """.format(test_cases='\n'.join(test_cases_c_code)))
 
-    def test_formats(self):
+    def test_formats(self, plan=False):
         test_cases = [
             ('return HPy_BuildValue(ctx, "");', None),
             ('return HPy_BuildValue(ctx, "i", 42);', 42),
@@ -63,12 +75,21 @@ class TestBuildValue(HPyTest):
             ('return HPy_BuildValue(ctx, "({s:(i,i), s:f},[i])", "A", 4, 4, "B", 0.25, 42);',
                 ({'A':(4, 4), "B":0.25}, [42])),
         ]
+        if plan:
+            test_cases = [(with_plan(code), expected)
+                          for code, expected in test_cases]
         mod = self.make_tests_module(test_cases)
         for i, (code, expected) in enumerate(test_cases):
             actual = mod.f(i)
             assert actual == expected, code
+            if plan:
+                # the second time the compiled plan is used
+                assert mod.f(i) == expected, code
 
-    def test_bad_formats(self):
+    def test_formats_with_plan(self):
+        self.test_formats(plan=True)
+
+    def test_bad_formats(self, plan=False):
         test_cases = [
             ('return HPy_BuildValue(ctx, "(q)", 42);',
              "bad format char 'q' in the format string passed to HPy_BuildValue"),
@@ -94,12 +115,18 @@ class TestBuildValue(HPyTest):
              "missing ':' in the format string passed to HPy_BuildValue"),
         ]
         import pytest
+        if plan:
+            test_cases = [(with_plan(code), expected_error)
+                          for code, expected_error in test_cases]
         mod = self.make_tests_module(test_cases)
         for i, (code, expected_error) in enumerate(test_cases):
             with pytest.raises(SystemError) as e:
                 mod.f(i)
             assert expected_error in str(e), code
 
+    def test_bad_formats_with_plan(self):
+        self.test_bad_formats(plan=True)
+
     def test_O_and_aliases(self):
         mod = self.make_module("""
             HPyDef_METH(fo, "fo", HPyFunc_O)
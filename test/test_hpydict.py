@@ -119,3 +119,113 @@ class TestDict(HPyTest):
             mod.f(None)
         with pytest.raises(SystemError):
             mod.f(42)
+
+    def test_next(self):
+        import pytest
+        mod = self.make_module("""
+            HPyDef_METH(items, "items", HPyFunc_O)
+            static HPy items_impl(HPyContext *ctx, HPy self, HPy arg)
+            {
+                HPy h_dict = HPy_Is(ctx, arg, ctx->h_None) ? HPy_NULL : arg;
+                HPy h_result = HPyList_New(ctx, 0);
+                if (HPy_IsNull(h_result))
+                    return HPy_NULL;
+                HPy_ssize_t pos = 0;
+                HPy key, value;
+                int res;
+                while ((res = HPyDict_Next(ctx, h_dict, &pos, &key, &value)) > 0) {
+                    HPy h_item = HPyTuple_Pack(ctx, 2, key, value);
+                    HPy_Close(ctx, key);
+                    HPy_Close(ctx, value);
+                    if (HPy_IsNull(h_item) ||
+                            HPyList_Append(ctx, h_result, h_item) < 0) {
+                        HPy_Close(ctx, h_item);
+                        HPy_Close(ctx, h_result);
+                        return HPy_NULL;
+                    }
+                    HPy_Close(ctx, h_item);
+                }
+                if (res < 0) {
+                    HPy_Close(ctx, h_result);
+                    return HPy_NULL;
+                }
+                return h_result;
+            }
+
+            // only get the keys or only the values
+            HPyDef_METH(count, "count", HPyFunc_VARARGS)
+            static HPy count_impl(HPyContext *ctx, HPy self,
+                                  const HPy *args, size_t nargs)
+            {
+                HPy h_dict;
+                int values;
+                if (!HPyArg_Parse(ctx, NULL, args, nargs, "Oi", &h_dict, &values))
+                    return HPy_NULL;
+                HPy_ssize_t pos = 0, n = 0;
+                HPy item;
+                while (HPyDict_Next(ctx, h_dict, &pos, values ? NULL : &item,
+                                    values ? &item : NULL) > 0) {
+                    n += HPyLong_AsSsize_t(ctx, item);
+                    HPy_Close(ctx, item);
+                }
+                return HPyLong_FromSsize_t(ctx, n);
+            }
+            @EXPORT(items)
+            @EXPORT(count)
+            @INIT
+        """)
+
+        class SubDict(dict):
+            def items(self):
+                return []
+        assert mod.items({}) == []
+        d = {'a': 1, 'b': 2, 'c': 3}
+        assert mod.items(d) == list(d.items())
+        assert mod.items(SubDict(x=1)) == [('x', 1)]
+        assert mod.count({1: 10, 2: 20}, 0) == 3
+        assert mod.count({1: 10, 2: 20}, 1) == 30
+        with pytest.raises(SystemError):
+            mod.items(None)
+        with pytest.raises(SystemError):
+            mod.items(42)
+
+    def test_dictbuilder(self):
+        import pytest
+        mod = self.make_module("""
+            // build {args[0]: args[1], args[2]: args[3], ...}
+            HPyDef_METH(f, "f", HPyFunc_VARARGS)
+            static HPy f_impl(HPyContext *ctx, HPy self,
+                              const HPy *args, size_t nargs)
+            {
+                HPyDictBuilder builder = HPyDictBuilder_New(ctx, nargs / 2);
+                for (size_t i = 0; i + 1 < nargs; i += 2) {
+                    if (HPyDictBuilder_Set(ctx, builder, args[i], args[i+1]) < 0) {
+                        HPyDictBuilder_Cancel(ctx, builder);
+                        return HPy_NULL;
+                    }
+                }
+                return HPyDictBuilder_Build(ctx, builder);
+            }
+
+            HPyDef_METH(g, "g", HPyFunc_NOARGS)
+            static HPy g_impl(HPyContext *ctx, HPy self)
+            {
+                HPyDictBuilder builder = HPyDictBuilder_New(ctx, 2);
+                if (HPyDictBuilder_Set_s(ctx, builder, "x", ctx->h_True) < 0 ||
+                        HPyDictBuilder_Set_s(ctx, builder, "y", ctx->h_None) < 0) {
+                    HPyDictBuilder_Cancel(ctx, builder);
+                    return HPy_NULL;
+                }
+                return HPyDictBuilder_Build(ctx, builder);
+            }
+            @EXPORT(f)
+            @EXPORT(g)
+            @INIT
+        """)
+        assert mod.f() == {}
+        assert mod.f('a', 1, 2, 'b') == {'a': 1, 2: 'b'}
+        # more items than expected and duplicate keys
+        assert mod.f('a', 1, 'a', 2, 'c', 3) == {'a': 2, 'c': 3}
+        with pytest.raises(TypeError):
+            mod.f('a', 1, [], 2)
+        assert mod.g() == {'x': True, 'y': None}
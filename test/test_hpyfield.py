@@ -248,6 +248,120 @@ class TestHPyField(HPyTest):
             p2.clear_a()
             assert sys.getrefcount(a) == a_refcnt
 
+    def test_store_load_many(self):
+        import sys
+        mod = self.make_module("""
+            @DEFINE_PairObject
+            @DEFINE_Pair_new
+            @DEFINE_Pair_get_ab
+            @DEFINE_Pair_traverse
+
+            HPyDef_METH(Pair_set_ab, "set_ab", HPyFunc_VARARGS)
+            static HPy Pair_set_ab_impl(HPyContext *ctx, HPy self,
+                                        const HPy *args, size_t nargs)
+            {
+                PairObject *pair = PairObject_AsStruct(ctx, self);
+                HPyField *fields[] = { &pair->a, &pair->b };
+                HPy hs[] = { HPy_NULL, HPy_NULL };
+                for (size_t i = 0; i < nargs && i < 2; i++)
+                    hs[i] = args[i];
+                HPyField_StoreMany(ctx, self, fields, hs, 2);
+                return HPy_Dup(ctx, ctx->h_None);
+            }
+
+            HPyDef_METH(Pair_swap, "swap", HPyFunc_NOARGS)
+            static HPy Pair_swap_impl(HPyContext *ctx, HPy self)
+            {
+                PairObject *pair = PairObject_AsStruct(ctx, self);
+                HPyField *fields[] = { &pair->a, &pair->b };
+                HPyField *swapped[] = { &pair->b, &pair->a };
+                HPy hs[2];
+                HPyField_LoadMany(ctx, self, fields, hs, 2);
+                HPyField_StoreMany(ctx, self, swapped, hs, 2);
+                HPy_CloseMany(ctx, hs, 2);
+                return HPy_Dup(ctx, ctx->h_None);
+            }
+
+            @PAIR_TYPE_FLAGS(HPy_TPFLAGS_DEFAULT)
+            @EXPORT_PAIR_TYPE(&Pair_new, &Pair_traverse, &Pair_get_a, &Pair_get_b, &Pair_set_ab, &Pair_swap)
+            @INIT
+        """)
+        p = mod.Pair("hello", "world")
+        p.swap()
+        assert p.get_a() == 'world'
+        assert p.get_b() == 'hello'
+        p.set_ab('foo')
+        assert p.get_a() == 'foo'
+        assert p.get_b() == '<NULL>'
+        p.set_ab('x', 'y')
+        assert (p.get_a(), p.get_b()) == ('x', 'y')
+        #
+        # check the refcnt
+        if self.supports_refcounts():
+            a = object()
+            a_refcnt = sys.getrefcount(a)
+            p2 = mod.Pair(a, None)
+            assert sys.getrefcount(a) == a_refcnt + 1
+            p2.swap()
+            assert sys.getrefcount(a) == a_refcnt + 1
+            assert p2.get_b() is a
+            p2.set_ab(a, a)
+            assert sys.getrefcount(a) == a_refcnt + 2
+            p2.set_ab()
+            assert sys.getrefcount(a) == a_refcnt
+
+    def test_write_barrier(self):
+        if self.compiler.hpy_abi != 'universal':
+            import pytest
+            pytest.skip("the write barrier is a member of the universal context")
+        mod = self.make_module("""
+            @DEFINE_PairObject
+            @DEFINE_Pair_new
+            @DEFINE_Pair_traverse
+            @DEFINE_Pair_set_a
+
+            static long barrier_count;
+            static void (*old_barrier)(HPyContext *ctx, HPy target_object);
+
+            static void count_barrier(HPyContext *ctx, HPy target_object)
+            {
+                barrier_count++;
+            }
+
+            HPyDef_METH(Pair_set_ab, "set_ab", HPyFunc_O)
+            static HPy Pair_set_ab_impl(HPyContext *ctx, HPy self, HPy arg)
+            {
+                PairObject *pair = PairObject_AsStruct(ctx, self);
+                HPyField *fields[] = { &pair->a, &pair->b };
+                HPy hs[] = { arg, arg };
+                HPyField_StoreMany(ctx, self, fields, hs, 2);
+                return HPy_Dup(ctx, ctx->h_None);
+            }
+
+            HPyDef_METH(count_barriers, "count_barriers", HPyFunc_O)
+            static HPy count_barriers_impl(HPyContext *ctx, HPy self, HPy arg)
+            {
+                barrier_count = 0;
+                old_barrier = ctx->ctx_Field_WriteBarrier;
+                ctx->ctx_Field_WriteBarrier = count_barrier;
+                HPy res = HPy_Call(ctx, arg, NULL, 0, HPy_NULL);
+                ctx->ctx_Field_WriteBarrier = old_barrier;
+                if (HPy_IsNull(res))
+                    return HPy_NULL;
+                HPy_Close(ctx, res);
+                return HPyLong_FromLong(ctx, barrier_count);
+            }
+
+            @PAIR_TYPE_FLAGS(HPy_TPFLAGS_DEFAULT)
+            @EXPORT_PAIR_TYPE(&Pair_new, &Pair_traverse, &Pair_set_a, &Pair_set_ab)
+            @EXPORT(count_barriers)
+            @INIT
+        """)
+        p = mod.Pair("hello", "world")
+        assert mod.count_barriers(lambda: p.set_a('foo')) == 1
+        assert mod.count_barriers(lambda: p.set_ab('foo')) == 1
+        assert mod.count_barriers(lambda: mod.Pair(1, 2)) == 2
+
     def test_automatic_tp_dealloc(self):
         import sys
         if not self.supports_refcounts():
@@ -87,4 +87,44 @@ class TestIter(HPyTest):
         with pytest.raises(StopIteration):
             assert mod.f(iter([]))
 
-        
+    def test_NextBatch(self):
+        import pytest
+        mod = self.make_module("""
+            HPyDef_METH(f, "f", HPyFunc_VARARGS)
+            static HPy f_impl(HPyContext *ctx, HPy self,
+                              const HPy *args, size_t nargs)
+            {
+                HPy it;
+                HPy_ssize_t n;
+                HPy items[8];
+                if (!HPyArg_Parse(ctx, NULL, args, nargs, "On", &it, &n))
+                    return HPy_NULL;
+                if (n > 8)
+                    n = 8;
+                HPy_ssize_t res = HPyIter_NextBatch(ctx, it, items, n);
+                if (res < 0)
+                    return HPy_NULL;
+                HPy result = HPyTuple_FromArray(ctx, items, res);
+                for (HPy_ssize_t i = 0; i < res; i++)
+                    HPy_Close(ctx, items[i]);
+                return result;
+            }
+            @EXPORT(f)
+            @INIT
+        """)
+
+        def gen():
+            yield 1
+            yield 2
+            raise ValueError("hello")
+
+        it = iter(range(10))
+        assert mod.f(it, 4) == (0, 1, 2, 3)
+        assert next(it) == 4
+        assert mod.f(it, 8) == (5, 6, 7, 8, 9)
+        assert mod.f(it, 8) == ()
+        assert mod.f(iter("ab"), 0) == ()
+        with pytest.raises(ValueError):
+            mod.f(gen(), 8)
+        with pytest.raises(TypeError):
+            mod.f([1, 2, 3], 2)
@@ -101,6 +101,99 @@ class TestHPyStructSequence(HPyTest):
             mod.build(str)
 
 
+    def test_structseq_new_checks_type(self):
+        import pytest
+        mod = self.make_module("""
+            static HPyStructSequence_Field fields[] = {
+                { "a", NULL },
+                { "b", NULL },
+                { NULL, NULL },
+            };
+
+            static HPyStructSequence_Desc desc = {
+                .name = "mytest.Point",
+                .fields = fields
+            };
+
+            HPyDef_METH(build, "build", HPyFunc_VARARGS)
+            static HPy build_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+            {
+                return HPyStructSequence_New(ctx, args[0], nargs - 1,
+                                             (HPy *)args + 1);
+            }
+
+            static void make_types(HPyContext *ctx, HPy module)
+            {
+                HPy h_type = HPyStructSequence_NewType(ctx, &desc);
+                if (HPy_IsNull(h_type))
+                    return;
+                HPy_SetAttr_s(ctx, module, "Point", h_type);
+                HPy_Close(ctx, h_type);
+            }
+
+            @EXPORT(build)
+            @EXTRA_INIT_FUNC(make_types)
+            @INIT
+        """)
+        p = mod.build(mod.Point, 1, 'x')
+        assert type(p) is mod.Point
+        assert (p.a, p.b) == (1, 'x')
+        assert tuple(p) == (1, 'x')
+        for i in range(100):
+            assert mod.build(mod.Point, i, i)[0] == i
+        with pytest.raises(TypeError):
+            mod.build(mod.Point, 1)
+        with pytest.raises(TypeError):
+            mod.build(mod.Point, 1, 2, 3)
+
+        if self.compiler.hpy_abi != 'cpython':
+            # in the CPython ABI, struct sequence types are not subclassable
+            class SubPoint(mod.Point):
+                pass
+            q = mod.build(SubPoint, 2, 3)
+            assert type(q) is SubPoint
+            assert q.b == 3
+
+            # the __new__ of subclasses is called
+            class NewPoint(mod.Point):
+                def __new__(cls, a, b):
+                    return super().__new__(cls, a * 10, b)
+            q = mod.build(NewPoint, 2, 3)
+            assert type(q) is NewPoint
+            assert tuple(q) == (20, 3)
+
+        class NotATuple:
+            n_fields = 2
+        with pytest.raises(TypeError):
+            mod.build(NotATuple, 1, 2)
+        with pytest.raises(TypeError):
+            mod.build(42, 1, 2)
+
+        # native struct sequence types count their hidden fields in n_fields:
+        # they must never be filled like the types created by
+        # HPyStructSequence_NewType
+        import time
+        args = (2024, 1, 2, 3, 4, 5, 1, 2, 0, 'UTC', 0)
+        if self.compiler.hpy_abi == 'cpython':
+            t = mod.build(time.struct_time, *args)
+            assert type(t) is time.struct_time
+            assert len(t) == 9
+            assert t == time.struct_time(args)
+            assert (t.tm_zone, t.tm_gmtoff) == ('UTC', 0)
+        else:
+            # the type is called with the items as arguments, which
+            # time.struct_time does not accept
+            with pytest.raises(TypeError):
+                mod.build(time.struct_time, *args)
+
+        if self.compiler.hpy_abi != 'cpython':
+            # the field count is read again if the type is modified
+            assert mod.build(mod.Point, 1, 2).a == 1
+            mod.Point.n_fields = 3
+            with pytest.raises(TypeError):
+                mod.build(mod.Point, 1, 2)
+
+
     def test_invalid_descriptor(self):
         import pytest
         mod = self.make_module("""
@@ -1646,6 +1646,89 @@ class TestPureHPyType(HPyTest):
         assert p42.x == 123
         assert p42.y == 456
 
+    def test_typed_members_shared_def(self):
+        if self.is_graalpy:
+            import pytest
+            pytest.skip("Not yet implemented on GraalPy")
+        # the same HPyDefs are used by two types whose payload starts at a
+        # different offset
+        mod = self.make_module("""
+            typedef struct {
+                double d;
+                long long ll;
+                HPy_ssize_t n;
+                char b;
+            } RecObject;
+            HPyType_HELPERS(RecObject)
+
+            typedef RecObject RecLong;
+            HPyType_HELPERS(RecLong, HPyType_BuiltinShape_Long)
+
+            HPyDef_MEMBER(Rec_d, "d", HPyMember_DOUBLE, offsetof(RecObject, d))
+            HPyDef_MEMBER(Rec_ll, "ll", HPyMember_LONGLONG, offsetof(RecObject, ll))
+            HPyDef_MEMBER(Rec_n, "n", HPyMember_HPYSSIZET, offsetof(RecObject, n),
+                          .readonly = 1)
+            HPyDef_MEMBER(Rec_b, "b", HPyMember_BOOL, offsetof(RecObject, b))
+
+            static HPyDef *Rec_defines[] = {
+                &Rec_d, &Rec_ll, &Rec_n, &Rec_b, NULL
+            };
+
+            static HPyType_Spec RecObject_spec = {
+                .name = "mytest.RecObject",
+                .basicsize = sizeof(RecObject),
+                .builtin_shape = SHAPE(RecObject),
+                .defines = Rec_defines
+            };
+
+            static HPyType_Spec RecLong_spec = {
+                .name = "mytest.RecLong",
+                .basicsize = sizeof(RecLong),
+                .builtin_shape = SHAPE(RecLong),
+                .defines = Rec_defines
+            };
+
+            static void make_RecLong(HPyContext *ctx, HPy module)
+            {
+                HPyType_SpecParam param[] = {
+                    { HPyType_SpecParam_Base, ctx->h_LongType },
+                    { (HPyType_SpecParam_Kind)0 }
+                };
+                HPy h_type = HPyType_FromSpec(ctx, &RecLong_spec, param);
+                if (HPy_IsNull(h_type))
+                    return;
+                HPy_SetAttr_s(ctx, module, "RecLong", h_type);
+                HPy_Close(ctx, h_type);
+            }
+            @EXPORT_TYPE("RecObject", RecObject_spec)
+            @EXTRA_INIT_FUNC(make_RecLong)
+            @INIT
+        """)
+        import pytest
+        for r in [mod.RecObject(), mod.RecLong(42)]:
+            assert r.d == 0.0
+            assert r.ll == 0
+            assert r.n == 0
+            assert r.b is False
+            r.d = 1.5
+            r.ll = -2**62
+            r.b = True
+            assert r.d == 1.5
+            assert r.ll == -2**62
+            assert r.b is True
+            with pytest.raises(TypeError):
+                r.d = "x"
+            with pytest.raises(OverflowError):
+                r.ll = 2**64
+            with pytest.raises(TypeError):
+                r.b = 1
+            with pytest.raises(TypeError):
+                del r.d
+            with pytest.raises(AttributeError):
+                r.n = 1
+            assert r.d == 1.5
+        assert r == 42
+
     def test_invalid_shape(self):
         import pytest
         with pytest.raises(ValueError):
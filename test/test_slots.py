@@ -491,6 +491,241 @@ class TestSlots(HPyTest):
             hash(mod.Point(-1, 10))
 
 
+    def test_tp_iter_and_tp_iternext(self):
+        mod = self.make_module("""
+            @DEFINE_PointObject
+            @DEFINE_Point_new
+
+            HPyDef_SLOT(Point_iter, HPy_tp_iter)
+            static HPy Point_iter_impl(HPyContext *ctx, HPy self)
+            {
+                return HPy_Dup(ctx, self);
+            }
+
+            // iterate over the range [x, y)
+            HPyDef_SLOT(Point_iternext, HPy_tp_iternext)
+            static HPy Point_iternext_impl(HPyContext *ctx, HPy self)
+            {
+                PointObject *p = PointObject_AsStruct(ctx, self);
+                if (p->x >= p->y)
+                    return HPy_NULL;
+                return HPyLong_FromLong(ctx, p->x++);
+            }
+
+            @EXPORT_POINT_TYPE(&Point_new, &Point_iter, &Point_iternext)
+            @INIT
+        """)
+        p = mod.Point(3, 7)
+        assert iter(p) is p
+        assert next(p) == 3
+        assert list(p) == [4, 5, 6]
+        with pytest.raises(StopIteration):
+            next(p)
+        assert list(mod.Point(5, 1)) == []
+
+    def test_tp_iternext_batch(self):
+        mod = self.make_module("""
+            @DEFINE_PointObject
+            @DEFINE_Point_new
+
+            HPyDef_SLOT(Point_iter, HPy_tp_iter)
+            static HPy Point_iter_impl(HPyContext *ctx, HPy self)
+            {
+                return HPy_Dup(ctx, self);
+            }
+
+            HPyDef_SLOT(Point_iternext, HPy_tp_iternext)
+            static HPy Point_iternext_impl(HPyContext *ctx, HPy self)
+            {
+                PointObject *p = PointObject_AsStruct(ctx, self);
+                if (p->x >= p->y)
+                    return HPy_NULL;
+                return HPyLong_FromLong(ctx, p->x++);
+            }
+
+            // same as Point_iternext, but the items are negated so that the
+            // test can check which slot was used
+            HPyDef_SLOT(Point_iternext_batch, HPy_tp_iternext_batch)
+            static HPy_ssize_t Point_iternext_batch_impl(HPyContext *ctx, HPy self,
+                                                         HPy *items, HPy_ssize_t n)
+            {
+                PointObject *p = PointObject_AsStruct(ctx, self);
+                if (p->x == 42) {
+                    HPyErr_SetString(ctx, ctx->h_ValueError, "42");
+                    return -1;
+                }
+                HPy_ssize_t i;
+                for (i = 0; i < n && p->x < p->y; i++) {
+                    items[i] = HPyLong_FromLong(ctx, -(p->x++));
+                    if (HPy_IsNull(items[i])) {
+                        while (i > 0)
+                            HPy_Close(ctx, items[--i]);
+                        return -1;
+                    }
+                }
+                return i;
+            }
+
+            HPyDef_METH(next_batch, "next_batch", HPyFunc_VARARGS)
+            static HPy next_batch_impl(HPyContext *ctx, HPy self,
+                                       const HPy *args, size_t nargs)
+            {
+                HPy it;
+                HPy_ssize_t n;
+                HPy items[16];
+                if (!HPyArg_Parse(ctx, NULL, args, nargs, "On", &it, &n))
+                    return HPy_NULL;
+                if (n > 16)
+                    n = 16;
+                HPy_ssize_t res = HPyIter_NextBatch(ctx, it, items, n);
+                if (res < 0)
+                    return HPy_NULL;
+                HPy h_result = HPyTuple_FromArray(ctx, items, res);
+                for (HPy_ssize_t i = 0; i < res; i++)
+                    HPy_Close(ctx, items[i]);
+                return h_result;
+            }
+
+            static HPyDef *BadIter_defines[] = {
+                &Point_iternext_batch,
+                NULL
+            };
+
+            static HPyType_Spec BadIter_spec = {
+                .name = "mytest.BadIter",
+                .basicsize = sizeof(PointObject),
+                .defines = BadIter_defines,
+            };
+
+            HPyDef_METH(make_bad_iter, "make_bad_iter", HPyFunc_NOARGS)
+            static HPy make_bad_iter_impl(HPyContext *ctx, HPy self)
+            {
+                return HPyType_FromSpec(ctx, &BadIter_spec, NULL);
+            }
+
+            @EXPORT_POINT_TYPE(&Point_new, &Point_iter, &Point_iternext, &Point_iternext_batch)
+            @EXPORT(next_batch)
+            @EXPORT(make_bad_iter)
+            @INIT
+        """)
+        p = mod.Point(0, 10)
+        assert mod.next_batch(p, 4) == (0, -1, -2, -3)
+        # Python code still uses HPy_tp_iternext
+        assert next(p) == 4
+        assert mod.next_batch(p, 16) == (-5, -6, -7, -8, -9)
+        assert mod.next_batch(p, 16) == ()
+        assert mod.next_batch(mod.Point(0, 10), 0) == ()
+        with pytest.raises(ValueError):
+            mod.next_batch(mod.Point(42, 50), 4)
+        with pytest.raises(TypeError) as exc:
+            mod.make_bad_iter()
+        assert 'HPy_tp_iternext_batch requires HPy_tp_iternext' in str(exc.value)
+
+    def test_am_await_aiter_anext_send(self):
+        import sys
+        mod = self.make_module("""
+            @DEFINE_PointObject
+            @DEFINE_Point_new
+
+            static long send_calls;
+
+            // awaiting Point(x, y) yields the values in [x, y) and returns y
+            HPyDef_SLOT(Point_await, HPy_am_await)
+            static HPy Point_await_impl(HPyContext *ctx, HPy self)
+            {
+                return HPy_Dup(ctx, self);
+            }
+
+            HPyDef_SLOT(Point_iternext, HPy_tp_iternext)
+            static HPy Point_iternext_impl(HPyContext *ctx, HPy self)
+            {
+                PointObject *p = PointObject_AsStruct(ctx, self);
+                if (p->x < p->y)
+                    return HPyLong_FromLong(ctx, p->x++);
+                HPy h_value = HPyLong_FromLong(ctx, p->y);
+                if (HPy_IsNull(h_value))
+                    return HPy_NULL;
+                HPyErr_SetObject(ctx, ctx->h_StopIteration, h_value);
+                HPy_Close(ctx, h_value);
+                return HPy_NULL;
+            }
+
+            HPyDef_SLOT(Point_send, HPy_am_send)
+            static HPySendResult Point_send_impl(HPyContext *ctx, HPy self,
+                                                 HPy value, HPy *result)
+            {
+                PointObject *p = PointObject_AsStruct(ctx, self);
+                send_calls++;
+                if (p->x < p->y) {
+                    *result = HPyLong_FromLong(ctx, p->x++);
+                    return HPy_IsNull(*result) ? HPySend_ERROR : HPySend_NEXT;
+                }
+                *result = HPyLong_FromLong(ctx, p->y);
+                return HPy_IsNull(*result) ? HPySend_ERROR : HPySend_RETURN;
+            }
+
+            // asynchronously iterating over Point(x, y) gives the values in
+            // [x, y), each one through an awaitable Point(i, i)
+            HPyDef_SLOT(Point_aiter, HPy_am_aiter)
+            static HPy Point_aiter_impl(HPyContext *ctx, HPy self)
+            {
+                return HPy_Dup(ctx, self);
+            }
+
+            HPyDef_SLOT(Point_anext, HPy_am_anext)
+            static HPy Point_anext_impl(HPyContext *ctx, HPy self)
+            {
+                PointObject *p = PointObject_AsStruct(ctx, self);
+                if (p->x >= p->y) {
+                    HPyErr_SetObject(ctx, ctx->h_StopAsyncIteration, ctx->h_None);
+                    return HPy_NULL;
+                }
+                HPy h_type = HPy_Type(ctx, self);
+                PointObject *q;
+                HPy h_result = HPy_New(ctx, h_type, &q);
+                HPy_Close(ctx, h_type);
+                if (HPy_IsNull(h_result))
+                    return HPy_NULL;
+                q->x = q->y = p->x++;
+                return h_result;
+            }
+
+            HPyDef_METH(get_send_calls, "get_send_calls", HPyFunc_NOARGS)
+            static HPy get_send_calls_impl(HPyContext *ctx, HPy self)
+            {
+                return HPyLong_FromLong(ctx, send_calls);
+            }
+
+            @EXPORT_POINT_TYPE(&Point_new, &Point_await, &Point_iternext, &Point_send, &Point_aiter, &Point_anext)
+            @EXPORT(get_send_calls)
+            @INIT
+        """)
+
+        def run(coro):
+            values = []
+            try:
+                while True:
+                    values.append(coro.send(None))
+            except StopIteration as e:
+                return values, e.value
+
+        async def await_point():
+            return await mod.Point(0, 3)
+
+        async def async_for():
+            return [i async for i in mod.Point(5, 8)]
+
+        p = mod.Point(0, 1)
+        assert p.__await__() is p
+        assert p.__aiter__() is p
+        assert run(await_point()) == ([0, 1, 2], 3)
+        assert run(async_for()) == ([], [5, 6, 7])
+        if sys.version_info >= (3, 10):
+            # CPython resumes the awaitables with am_send
+            assert mod.get_send_calls() > 0
+        else:
+            assert mod.get_send_calls() == 0
+
 class TestSqSlots(HPyTest):
 
     ExtensionTemplate = PointTemplate
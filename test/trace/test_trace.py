@@ -125,3 +125,245 @@ def test_trace_funcs(compiler):
 
     with pytest.raises(TypeError):
         set_trace_functions(1)
+    # don't leak the trace functions into the other tests
+    set_trace_functions(on_exit=None)
+    assert mod.f(2, 3) == 5
+    assert on_exit_cnt == 2
+
+
+def test_sample_period(compiler):
+    from collections import Counter
+    from hpy.trace import (get_timed_call_counts, get_sample_period,
+                           set_sample_period)
+    mod = compiler.make_module("""
+        HPyDef_METH(f, "f", HPyFunc_VARARGS)
+        static HPy f_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+        {
+            return HPy_Add(ctx, args[0], args[1]);
+        }
+
+        @EXPORT(f)
+        @INIT
+    """)
+    assert get_sample_period() == 1
+    with pytest.raises(ValueError):
+        set_sample_period(0)
+    set_sample_period(4)
+    try:
+        assert get_sample_period() == 4
+        calls0 = get_call_counter()
+        timed0 = Counter(get_timed_call_counts())
+        for i in range(10):
+            assert mod.f(i, 1) == i + 1
+        # all calls are counted, but only one every 4 calls is timed
+        assert get_call_counter() - calls0 == {"ctx_Add": 10}
+        timed = Counter(get_timed_call_counts()) - timed0
+        assert timed["ctx_Add"] in (2, 3)
+    finally:
+        set_sample_period(1)
+    calls0 = get_call_counter()
+    timed0 = Counter(get_timed_call_counts())
+    mod.f(1, 2)
+    assert Counter(get_timed_call_counts()) - timed0 == get_call_counter() - calls0
+
+
+def test_get_call_counts_by_module(compiler):
+    from collections import Counter
+    from hpy.trace import get_call_counts_by_module, get_durations_by_module
+    src = """
+        HPyDef_METH(f, "f", HPyFunc_VARARGS)
+        static HPy f_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+        {
+            return HPy_Add(ctx, args[0], args[1]);
+        }
+
+        @EXPORT(f)
+        @INIT
+    """
+    mod_a = compiler.make_module(src, name='trace_by_module_a')
+    mod_b = compiler.make_module(src, name='trace_by_module_b')
+    name_a = mod_a.__name__
+    name_b = mod_b.__name__
+
+    def get_counters():
+        return {name: Counter(counts)
+                for name, counts in get_call_counts_by_module().items()}
+
+    counts0 = get_counters()
+    total0 = get_call_counter()
+    assert mod_a.f(1, 2) == 3
+    assert mod_a.f(3, 4) == 7
+    assert mod_b.f(5, 6) == 11
+    counts = get_counters()
+    assert counts[name_a] - counts0[name_a] == {"ctx_Add": 2}
+    assert counts[name_b] - counts0[name_b] == {"ctx_Add": 1}
+    # the global counters include the calls of all modules
+    assert get_call_counter() - total0 == {"ctx_Add": 3}
+    #
+    durations = get_durations_by_module()
+    assert set(durations[name_a]) == set(counts[name_a])
+    assert durations[name_a]["ctx_Add"] > 0
+
+
+def test_dump_events(compiler, tmpdir):
+    from hpy.trace import (get_event_buffer_size, set_event_buffer_size,
+                           dump_events)
+    from hpy.trace import events
+    mod = compiler.make_module("""
+        HPyDef_METH(f, "f", HPyFunc_VARARGS)
+        static HPy f_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+        {
+            return HPy_Add(ctx, args[0], args[1]);
+        }
+
+        HPyDef_METH(g, "g", HPyFunc_O)
+        static HPy g_impl(HPyContext *ctx, HPy self, HPy arg)
+        {
+            HPy_ssize_t size;
+            if (HPyUnicode_AsUTF8AndSize(ctx, arg, &size) == NULL)
+                return HPy_NULL;
+            return HPyLong_FromSsize_t(ctx, size);
+        }
+
+        @EXPORT(f)
+        @EXPORT(g)
+        @INIT
+    """, name='trace_events_mod')
+    assert get_event_buffer_size() == 0
+    set_event_buffer_size(5)
+    try:
+        # the size is rounded up to a power of 2
+        assert get_event_buffer_size() == 8
+        assert mod.f(1, 2) == 3
+        fname = str(tmpdir.join('trace.bin'))
+        n = dump_events(fname)
+        evs = [ev for ev in events.read_events(fname) if ev.func == 'ctx_Add']
+        assert len(evs) == 1
+        assert evs[0].module == mod.__name__
+        assert evs[0].start_ns > 0
+        assert n >= 1
+        # the ids of the most recently added functions are the largest ones
+        set_event_buffer_size(8)
+        assert mod.g('ab') == 2
+        dump_events(fname)
+        funcs = [ev.func for ev in events.read_events(fname)]
+        assert 'ctx_Unicode_AsUTF8AndSize' in funcs
+        # fill the buffer: only the most recent events are kept
+        for i in range(20):
+            mod.f(i, 1)
+        assert dump_events(fname) == 8
+        with events.EventFile(fname) as f:
+            assert len(f) == 8
+            assert f.n_dropped > 0
+            evs = list(f)
+        assert [ev.func for ev in evs] == ['ctx_Add'] * 8
+        assert evs == sorted(evs, key=lambda ev: ev.start_ns)
+        chrome = events.to_chrome_trace(evs)
+        assert len(chrome['traceEvents']) == 8
+        assert chrome['traceEvents'][0]['name'] == 'ctx_Add'
+        profile = events.flat_profile(evs)
+        assert [(e.func, e.count) for e in profile] == [('ctx_Add', 8)]
+    finally:
+        set_event_buffer_size(0)
+    assert get_event_buffer_size() == 0
+
+
+def test_call_counts_multiple_threads(compiler):
+    import threading
+    mod = compiler.make_module("""
+        HPyDef_METH(f, "f", HPyFunc_VARARGS)
+        static HPy f_impl(HPyContext *ctx, HPy self, const HPy *args, size_t nargs)
+        {
+            HPyThreadState state = HPy_LeavePythonExecution(ctx);
+            HPy_ReenterPythonExecution(ctx, state);
+            return HPy_Add(ctx, args[0], args[1]);
+        }
+
+        @EXPORT(f)
+        @INIT
+    """)
+    n_threads = 4
+    n_calls = 100
+    calls0 = get_call_counter()
+    durations0 = get_durations()
+
+    def run():
+        for i in range(n_calls):
+            mod.f(i, 1)
+
+    threads = [threading.Thread(target=run) for i in range(n_threads)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    # the counters of all the threads (also the terminated ones) are merged
+    assert get_call_counter() - calls0 == {
+        "ctx_Add": n_threads * n_calls,
+        "ctx_LeavePythonExecution": n_threads * n_calls,
+        "ctx_ReenterPythonExecution": n_threads * n_calls,
+    }
+    assert get_durations()["ctx_Add"] > durations0["ctx_Add"]
+
+
+def test_latency_histograms(compiler):
+    import time
+    from hpy.trace import (get_histograms, get_histogram_bounds,
+                           get_max_durations, get_latency_stats,
+                           histogram_percentile)
+    mod = compiler.make_module("""
+        HPyDef_METH(f, "f", HPyFunc_O)
+        static HPy f_impl(HPyContext *ctx, HPy self, HPy arg)
+        {
+            return HPy_CallTupleDict(ctx, arg, HPy_NULL, HPy_NULL);
+        }
+
+        @EXPORT(f)
+        @INIT
+    """)
+    bounds = get_histogram_bounds()
+    assert bounds[0] == 0
+    assert bounds == sorted(bounds)
+    assert len(bounds) == len(set(bounds))
+    assert bounds[-1] >= 10**9
+
+    def delta_histogram():
+        return [n - n0 for n, n0 in
+                zip(get_histograms()["ctx_CallTupleDict"], hist0)]
+
+    mod.f(lambda: None)
+    hist0 = get_histograms()["ctx_CallTupleDict"]
+    assert len(hist0) == len(bounds)
+    for i in range(98):
+        mod.f(lambda: None)
+    mod.f(lambda: time.sleep(0.02))
+    mod.f(lambda: time.sleep(0.02))
+    hist = delta_histogram()
+    assert sum(hist) == 100
+    # the average would hide the two slow calls, the 99th percentile does not
+    p50 = histogram_percentile(hist, 50, bounds=bounds)
+    p99 = histogram_percentile(hist, 99, bounds=bounds)
+    assert p50 < 10**7
+    assert p99 >= 2 * 10**7
+    assert get_max_durations()["ctx_CallTupleDict"] >= 2 * 10**7
+    assert histogram_percentile([0] * len(bounds), 50, bounds=bounds) is None
+    #
+    stats = {s.func: s for s in get_latency_stats()}
+    s = stats["ctx_CallTupleDict"]
+    assert s.count >= 101
+    assert s.p50_ns <= s.p99_ns <= s.max_ns
+
+
+def test_latency_report(compiler, tmpdir, capsys, monkeypatch):
+    from hpy.trace import report
+    # report.main() sets HPY=trace if it is not set
+    monkeypatch.setenv('HPY', 'trace')
+    script = tmpdir.join('script.py')
+    out = tmpdir.join('argv.txt')
+    script.write("import sys\n"
+                 "open(%r, 'w').write(' '.join(sys.argv[1:]))\n" % str(out))
+    report.main(['-n', '3', str(script), 'a', '-b'])
+    assert out.read() == 'a -b'
+    lines = capsys.readouterr().out.splitlines()
+    assert lines[0].split() == ['function', 'calls', 'p50', '[ns]', 'p99',
+                                '[ns]', 'max', '[ns]']
+    assert len(lines) <= 4